@@ -6,10 +6,7 @@ FollowMe_SetStateHook:
 	mov r1, r5
 	mov r5, r0
 	mov r0, r4
-	push {r0-r1}
-	bl ShouldFollowerIgnoreActiveScript
-	mov r2, r0
-	pop {r0-r1}
+	mov r2, #0 @ Active script flag is only read once the player is known to be moving
 	bl FollowMe
 	mov r0, r5
 	pop {r4, r5}
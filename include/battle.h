@@ -857,11 +857,13 @@ struct NewBattleStruct
 	bool8 calculatedSpreadMoveAccuracy : 1;  //After the accuracy has been calculated for all Pokemon hit by a spread move
 	bool8 breakDisguiseSpecialDmg : 1;
 	bool8 handlingFaintSwitching : 1;
+	bool8 speedSnapshotTaken : 1;
 
 	//Other
 	u16 LastUsedMove;
 	u16 NewWishHealthSave;
 	u32 totalDamageGiven;
+	u32 speedSnapshot[MAX_BATTLERS_COUNT]; //Speeds kept while sorting the turn order, filled when first needed
 	u8 DancerTurnOrder[MAX_BATTLERS_COUNT];
 	u8 PayDayByPartyIndices[PARTY_SIZE];
 	item_t SavedConsumedItems[PARTY_SIZE];
@@ -892,6 +894,8 @@ struct NewBattleStruct
 		u8 activeBank;
 		const u8* script;
 		bool8 megaEvoInProgress : 1; //Used to tell the game whether or not the turn order should be recalculated
+		bool8 playerKeystoneLoaded : 1;
+		u16 playerKeystone; //The player's bag can't gain or lose a Keystone mid-battle, so only look for it once
 	} megaData;
 
 	struct
@@ -931,9 +935,11 @@ struct NewBattleStruct
 		bool8 raidShieldsUp : 1;
 		bool8 attackAgain : 1;
 		bool8 nullifiedStats : 1;
+		bool8 playerDynamaxBandLoaded : 1;
 		u8 backupMoveSelectionCursorPos;
 		u16 turnStartHP;
 		u16 backupRaidMonItem;
+		u16 playerDynamaxBand; //Looked for in the bag once per battle
 	} dynamaxData;
 
 	struct 
@@ -945,6 +951,7 @@ struct NewBattleStruct
 		bool8 moveKnocksOut1Hit[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_MON_MOVES]; //moveKnocksOut1Hit[bankAtk][bankDef][monMoveIndex]
 		bool8 moveKnocksOut2Hits[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_MON_MOVES]; //moveKnocksOut2Hits[bankAtk][bankDef][monMoveIndex]
 		u32 damageByMove[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_MON_MOVES]; //damageByMove[bankAtk][bankDef][monMoveIndex]
+		u32 maxRollDamageByMove[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_MON_MOVES]; //maxRollDamageByMove[bankAtk][bankDef][monMoveIndex] - 0 if the damage doesn't depend on a random roll
 		u16 bestDoublesKillingMoves[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT]; //bestDoublesKillingMoves[bankAtk][bankDef]
 		s8 bestDoublesKillingScores[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT]; //bestDoublesKillingScores[bankAtk][bankDef][bankDef / bankDefPartner / bankAtkPartner]
 		bool8 canKnockOut[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT]; //canKnockOut[bankAtk][bankDef]
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../global.h"
+#include "../../src/config.h"
+#include "util.h"
+
+/**
+ * \file ai_trace.h
+ * \brief Contains a ring buffer the AI writes its decisions and their costs to
+ *		  when DEBUG_AI_TRACE is defined, so they can be dumped from an emulator.
+ */
+
+#define AI_TRACE_MAGIC 0x52544941 //"AITR"
+#define AI_TRACE_NUM_RECORDS 64
+
+enum AITraceRecordTypes
+{
+	AI_TRACE_PHASE,				//index = phase, ticks and frames = time spent in it
+	AI_TRACE_MOVE_VIABILITY,	//index = move slot, value = move, score = viability after the negatives and positives
+	AI_TRACE_SWITCH_CANDIDATE,	//index = party slot, value = species, score = switching score
+	AI_TRACE_CHOSEN_MOVE,		//index = move slot or AI_CHOICE_*, value = move
+	AI_TRACE_CHOSEN_SWITCH,		//index = party slot, value = species
+};
+
+enum AITracePhases
+{
+	AI_TRACE_PHASE_STRONGEST_MOVES,
+	AI_TRACE_PHASE_DOUBLES_KILLING_MOVES,
+	AI_TRACE_PHASE_PREDICT_MOVES,
+	AI_TRACE_PHASE_DYNAMAX,
+	AI_TRACE_PHASE_SWITCHING,
+	AI_TRACE_PHASE_CHOOSE_MOVE,
+};
+
+//Exported Structs
+struct AITraceRecord
+{
+	u8 type;
+	u8 bankAtk;
+	u8 bankDef;
+	u8 index;
+	u16 value;
+	s16 score;
+	u16 ticks; //Multiply by DEBUG_TIMER_CYCLES_PER_TICK for cycles - wraps on phases longer than the timer's range
+	u8 turn;
+	u8 frames; //Frames that passed during the phase, saturating - tells how many times ticks wrapped
+};
+
+struct AITrace
+{
+	u32 magic;
+	u16 next; //Slot the next record will be written to
+	u16 total; //Records written since the buffer was set up, saturating
+	struct AITraceRecord records[AI_TRACE_NUM_RECORDS];
+};
+
+#ifdef DEBUG_AI_TRACE
+#define AI_TRACE(type, bankAtk, bankDef, index, value, score) AITrace_Record(type, bankAtk, bankDef, index, value, score, 0, 0)
+#define AI_TRACE_PHASE_START(timer) u16 timer = GetDebugTimerTicks(); u32 timer##Frame = gMain.vblankCounter2
+#define AI_TRACE_PHASE_END(timer, phase, bank) AITrace_Record(AI_TRACE_PHASE, bank, 0xFF, phase, 0, 0, GetDebugTimerTicks() - timer, gMain.vblankCounter2 - timer##Frame)
+#else
+#define AI_TRACE(type, bankAtk, bankDef, index, value, score)
+#define AI_TRACE_PHASE_START(timer)
+#define AI_TRACE_PHASE_END(timer, phase, bank)
+#endif
+
+//Exported Functions
+void AITrace_Record(u8 type, u8 bankAtk, u8 bankDef, u8 index, u16 value, s16 score, u16 ticks, u32 frames);
@@ -21,6 +21,7 @@ u8 GetDoubleKillingScore(u16 move, u8 bankAtk, u8 bankDef);
 void TryRemoveDoublesKillingScore(u8 bankAtk, u8 bankDef, u16 chosenMove);
 bool8 RangeMoveCanHurtPartner(u16 move, u8 bankAtk, u8 bankAtkPartner);
 bool8 MoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 numHits);
+u8 GetMoveKOChance(u16 move, u8 bankAtk, u8 bankDef, u8 numHits);
 bool8 MoveKnocksOutXHitsFromParty(u16 move, struct Pokemon* monAtk, u8 bankDef, u8 numHits, struct DamageCalc* damageData);
 u16 CalcFinalAIMoveDamage(u16 move, u8 bankAtk, u8 bankDef, u8 numHits, struct DamageCalc* damageData);
 u32 GetFinalAIMoveDamage(u16 move, u8 bankAtk, u8 bankDef, u8 numHits, struct DamageCalc* damageData);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "../global.h"
+
+/**
+ * \file battle_replay.h
+ * \brief Contains functions for recording the inputs of a battle and playing them
+ *		  back later. Only built when DEBUG_BATTLE_REPLAY is defined.
+ */
+
+#define BATTLE_REPLAY_MAGIC 0x50524142 //"BARP"
+#define BATTLE_REPLAY_NUM_RUNS 311 //Key changes that fit in the buffer - see DEBUG_BATTLE_REPLAY in config.h
+
+enum BattleReplayModes
+{
+	BATTLE_REPLAY_IDLE,
+	BATTLE_REPLAY_RECORDING,
+	BATTLE_REPLAY_PLAYING,
+	BATTLE_REPLAY_PLAY_NEXT_BATTLE, //Set by a debugger to play the stored replay at the start of the next battle
+};
+
+//Exported Structs
+struct BattleReplayKeyRun
+{
+	u16 keys;
+	u16 frames; //Number of frames in a row the keys were held
+};
+
+struct BattleReplay
+{
+	u32 magic;
+	u32 seed; //gRngValue when the battle started
+	u8 mode;
+	bool8 overflowed; //The battle was too long to be fully recorded
+	u16 numRuns;
+	u16 playbackRun;
+	u16 playbackFrame;
+	u32 framesInBattle;
+	struct BattleReplayKeyRun runs[BATTLE_REPLAY_NUM_RUNS];
+};
+
+//Exported Functions
+void StartBattleReplay(void);
+u16 TryRecordOrReplayBattleKeys(u16 keys);
@@ -18,6 +18,8 @@ s8 PriorityCalcMon(struct Pokemon* mon, u16 move);
 s32 BracketCalc(u8 bank);
 u32 SpeedCalc(u8 bank);
 u32 SpeedCalcMon(u8 side, struct Pokemon* mon);
+void TakeSpeedSnapshot(void);
+void ClearSpeedSnapshot(void);
 
 //Hooked in Functions
 void HandleNewBattleRamClearBeforeBattle(void);
@@ -66,6 +66,9 @@ struct DamageCalc
 	u8 specialFlags;
 	bool8 attackerLoaded;
 	bool8 defenderLoaded;
+	bool8 defenderModifiersApplied; //Defense & Sp. Def already include the boosts that don't depend on the move
+
+	u32 maxRollDamage; //Set by the AI calcs - damage of a single hit at the highest random roll
 };
 
 //Exported Functions
@@ -90,6 +93,7 @@ u8 CalcMonHiddenPowerType(struct Pokemon* mon);
 void atk05_damagecalc(void);
 void FutureSightDamageCalc(void);
 s32 ConfusionDamageCalc(void);
+bool8 AI_AdjustDamageForMultiHits(u32* damage, u16 move, u8 bankAtk, u8 atkAbility);
 u32 AI_CalcDmg(const u8 bankAtk, const u8 bankDef, const u16 move, struct DamageCalc* damageData);
 u32 AI_CalcPartyDmg(u8 bankAtk, u8 bankDef, u16 move, struct Pokemon* mon, struct DamageCalc* damageData);
 u32 AI_CalcMonDefDmg(u8 bankAtk, u8 bankDef, u16 move, struct Pokemon* monDef, struct DamageCalc* damageData);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../global.h"
+#include "../constants/moves.h"
 
 /**
  * \file move_tables.h
@@ -64,3 +65,72 @@ extern const move_t gSpecialAttackPhysicalDamageMoves[];
 extern const move_t gSpecialWholeFieldMoves[];
 extern const move_t gAromaVeilProtectedMoves[];
 extern const move_t gMovesThatLiftProtectTable[];
+
+//Packed Move Table Flags
+//scripts/move_tables.py also compiles every table above into a bitfield per move,
+//so membership can be checked without scanning the table. The order of this enum
+//determines each table's bit.
+enum MoveTableBits
+{
+	gGravityBannedMovesBit,
+	gMeFirstBannedMovesBit,
+	gCopycatBannedMovesBit,
+	gInstructBannedMovesBit,
+	gMetronomeBannedMovesBit,
+	gAssistBannedMovesBit,
+	gMimicBannedMovesBit,
+	gSleepTalkBannedMovesBit,
+	gParentalBondBannedMovesBit,
+	gSkyBattleBannedMovesBit,
+	gRaidBattleBannedMovesBit,
+	gRaidBattleBannedRaidMonMovesBit,
+	gDynamaxBannedMovesBit,
+	gSheerForceBoostedMovesBit,
+	gRecklessBoostedMovesBit,
+	gPunchingMovesBit,
+	gPulseAuraMovesBit,
+	gBitingMovesBit,
+	gBallBombMovesBit,
+	gDanceMovesBit,
+	gPowderMovesBit,
+	gSoundMovesBit,
+	gSubstituteBypassMovesBit,
+	gTypeChangeExceptionMovesBit,
+	gIgnoreStatChangesMovesBit,
+	gHighCriticalChanceMovesBit,
+	gAlwaysCriticalMovesBit,
+	gMovesThatCallOtherMovesBit,
+	gMovesThatRequireRechargingBit,
+	gAlwaysHitWhenMinimizedMovesBit,
+	gMoldBreakerMovesBit,
+	gFlinchChanceMovesBit,
+	gMovesCanUnfreezeAttackerBit,
+	gMovesCanUnfreezeTargetBit,
+	gMovesThatChangePhysicalityBit,
+	gTwoToFiveStrikesMovesBit,
+	gTwoStrikesMovesBit,
+	gThreeStrikesMovesBit,
+	gPercent25RecoilMovesBit,
+	gPercent33RecoilMovesBit,
+	gPercent50RecoilMovesBit,
+	gPercent66RecoilMovesBit,
+	gPercent75RecoilMovesBit,
+	gPercent100RecoilMovesBit,
+	gIgnoreInAirMovesBit,
+	gIgnoreUndergoundMovesBit,
+	gIgnoreUnderwaterMovesBit,
+	gAlwaysHitInRainMovesBit,
+	gSpecialAttackPhysicalDamageMovesBit,
+	gSpecialWholeFieldMovesBit,
+	gAromaVeilProtectedMovesBit,
+	gMovesThatLiftProtectTableBit,
+	NUM_MOVE_TABLE_BITS,
+};
+
+#define NUM_MOVE_TABLE_FLAG_WORDS ((NUM_MOVE_TABLE_BITS + 31) / 32)
+
+extern const u32 gMoveTableFlags[MOVES_COUNT][NUM_MOVE_TABLE_FLAG_WORDS];
+
+//Use instead of CheckTableForMove for any of the tables above
+#define IsMoveInTable(move, table) ((move) < MOVES_COUNT \
+	&& (gMoveTableFlags[(move)][table##Bit / 32] & (1u << (table##Bit % 32))) != 0)
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../global.h"
+#include "../../src/config.h"
+#include "util.h"
 /**
  * \file overworld.h
  * \brief Contains functions relating to the things that happen in the overworld. This
@@ -43,6 +45,9 @@ void ChooseMiningSpotToShow(void);
 void IsBestMiningSpotOutOfView(void);
 void ResetMiningSpots(void);
 bool8 IsValidMiningSpot(s16 x, s16 y);
+void ClearMetatileAttributeCache(void);
+u32 GetCachedMetatileAttributeAt(s16 x, s16 y, u8 attributeType);
+u32 GetCachedMetatileBehaviorAt(s16 x, s16 y);
 
 //Functions Hooked In
 u8 CheckForTrainersWantingBattle(void);
@@ -61,6 +66,7 @@ s32 DoPoisonFieldEffect(void);
 void TaskRepel(u8 taskId);
 bool8 UpdateRepelCounter(void);
 const u8* GetInteractedWaterScript(u32 unused1, u8 metatileBehavior, u8 direction);
+void EndMapScriptProfile(u16 startTime, u8 kind);
 
 //Exported Constants
 enum
@@ -69,6 +75,23 @@ enum
 	SHOULD_BE_SURFING,
 };
 
+enum MapScriptProfileKinds
+{
+	MAP_SCRIPT_PROFILE_ON_TRANSITION,
+	MAP_SCRIPT_PROFILE_ON_RESUME,
+	MAP_SCRIPT_PROFILE_ON_FRAME_CHECK,
+	MAP_SCRIPT_PROFILE_SPECIAL_TYPE_IN_PARTY,	//sp0B2_PokemonTypeInParty
+	MAP_SCRIPT_PROFILE_SPECIAL_TMHM_IN_PARTY,	//sp0D0_PokemonInPartyThatCanLearnTMHM
+};
+
+#ifdef DEBUG_MAP_SCRIPT_PROFILING
+#define MAP_SCRIPT_PROFILE_START(timer) u16 timer = GetDebugTimerTicks()
+#define MAP_SCRIPT_PROFILE_END(timer, kind) EndMapScriptProfile(timer, kind)
+#else
+#define MAP_SCRIPT_PROFILE_START(timer)
+#define MAP_SCRIPT_PROFILE_END(timer, kind)
+#endif
+
 //Exported Data Structures
 struct Pedometers
 {
@@ -199,6 +199,12 @@ extern u8 gFishingStreak; //0x203E058
 //#define sRTCProbeResult (*((u8*) 0x203E05E))
 //#define sRTCFrameCount (*((u8*) 0x203E05F))
 extern struct Coords16 gMiningSpots[8]; //0x203E060
-//FREE: 0x203E080
+//#define sWildHeaderCache //0x203E080 - 0x203E08A
+//FREE: 0x203E08A
 
 //extern struct CompressedPokemon gTempTeamBackup[6] //0x203E1A4
+//#define sMetatileAttributeCache //0x203E300 - 0x203EB08
+//#define gAITrace //0x203EB08 - 0x203EE10 (DEBUG_AI_TRACE only)
+//#define gBattleReplay //0x203EE10 - 0x203F300 (DEBUG_BATTLE_REPLAY only)
+//#define sMapScriptProfile //0x203F300 - 0x203F334 (DEBUG_MAP_SCRIPT_PROFILING only)
+//FREE: 0x203F334
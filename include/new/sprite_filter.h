@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../global.h"
+
+/**
+ * \file sprite_filter.h
+ * \brief Contains filters for 4bpp sprite graphics and their palettes. The tile
+ *		  filters work on a whole tile row (8 pixels) per 32-bit word.
+ */
+
+//Exported Functions
+void OutlineSpriteTiles(u32* tiles, u8 widthTiles, u8 heightTiles, u8 bodyColour, u8 outlineColour);
+void SilhouetteSpriteTiles(u32* tiles, u8 widthTiles, u8 heightTiles, u8 colour);
+u16 GrayscaleColour(u16 colour);
+u16 TintColour(u16 colour, u16 tint, u8 coeff);
@@ -9,6 +9,8 @@
  *		  help in the overworld.
  */
 
+#define DEBUG_TIMER_CYCLES_PER_TICK 1024 //GetDebugTimerTicks counts in ticks of this many cycles, wrapping after about 4 seconds
+
 //Exported Functions
 u32 MathMax(u32 num1, u32 num2);
 u32 MathMin(u32 num1, u32 num2);
@@ -39,3 +41,4 @@ bool8 CanPartyMonBePoisoned(struct Pokemon* mon);
 bool8 CanPartyMonBeParalyzed(struct Pokemon* mon);
 bool8 CanPartyMonBeBurned(struct Pokemon* mon);
 bool8 CanPartyMonBeFrozen(struct Pokemon* mon);
+u16 GetDebugTimerTicks(void);
@@ -27,6 +27,7 @@ void TrySetWildDoubleBattleTypeScripted();
 species_t GetLocalWildMon(bool8* isWaterMon);
 u16 GetLocalWaterMon(void);
 const struct WildPokemonInfo* LoadProperMonsData(u8 type);
+void ClearWildHeaderCache(void);
 
 //Exported COnstants
 enum
@@ -10,6 +10,8 @@ import subprocess
 import sys
 from string import StringFileConverter
 from make import ChangeFileLine
+from move_tables import MoveTableFlagsConverter, MoveTableFlagsFile, MoveTablesAssembly, MoveTablesHeader
+from graphics_bank import GraphicsBankConverter, GraphicsBankFile, GraphicsBankInputList
 
 if sys.platform.startswith('win'):
     PathVar = os.environ.get('Path')
@@ -124,15 +126,6 @@ def MakeGeneralOutputFile(fileName: str) -> [str, bool]:
     return CreateOutputFile(fileName, newFileName)
 
 
-def MakeOutputImageFile(assemblyFile: str) -> [str, bool]:
-    """Return 'IMG_' + hash of filename to use as object filename."""
-    m = hashlib.md5()
-    m.update(assemblyFile.encode())
-    objectFile = os.path.join(BUILD, 'IMG_' + m.hexdigest() + '.o')
-
-    return CreateOutputFile(assemblyFile, objectFile)
-
-
 def MakeOutputAudioFile(assemblyFile: str) -> [str, bool]:
     """Return "SND_" + hash of filename to use as object filename."""
     objectFile = os.path.join(BUILD, 'SND_' + assemblyFile.split("Wav_")[1].split(".s")[0] + '.o')
@@ -247,8 +240,20 @@ def ProcessString(stringFile: str) -> str:
     return objectFile
 
 
+def ProcessMoveTableFlags() -> str:
+    """Build and compile the packed move table flags."""
+    if os.path.isfile(MoveTableFlagsFile) \
+            and os.path.getmtime(MoveTableFlagsFile) > os.path.getmtime(MoveTablesAssembly) \
+            and os.path.getmtime(MoveTableFlagsFile) > os.path.getmtime(MoveTablesHeader):
+        # If the flags were generated after the move tables were last modified
+        return ProcessC(MoveTableFlagsFile)
+
+    print('Building Move Table Flags')
+    return ProcessC(MoveTableFlagsConverter())
+
+
 def ProcessImage(imageFile: str) -> str:
-    """Compile image."""
+    """Run grit on an image and return the assembly it produced."""
     if '.bmp' in imageFile:
         assemblyFile = imageFile.split('.bmp')[0] + '.s'
     else:
@@ -275,8 +280,46 @@ def ProcessImage(imageFile: str) -> str:
         print('Error: No gritflags.txt found in directory with ' + imageFile + '.')
         sys.exit(1)
 
-    return DoMiddleManAssembly(imageFile, assemblyFile, flagFile, flags, cmd,
-                               MakeOutputImageFile, Master.printCompilingImages, False)
+    # The grit output is kept so the graphics bank can be rebuilt without rerunning grit
+    m = hashlib.md5()
+    m.update(assemblyFile.encode())
+    savedAssemblyFile = os.path.join(BUILD, 'IMG_' + m.hexdigest() + '.s')
+
+    if os.path.isfile(savedAssemblyFile) \
+            and os.path.getmtime(savedAssemblyFile) > os.path.getmtime(imageFile) \
+            and os.path.getmtime(savedAssemblyFile) > os.path.getmtime(flagFile):
+        # If the assembly was created after the image and flag file were last modified
+        return savedAssemblyFile
+
+    Master.printCompilingImages()
+    RunCommand(cmd)
+    os.replace(assemblyFile, savedAssemblyFile)  # Grit names the symbols after the file it writes to
+    return savedAssemblyFile
+
+
+def ProcessGraphicsBank(assemblyFiles: [str]) -> str:
+    """Combine the images into one bank of unique data and assemble it."""
+    assemblyFiles = sorted(assemblyFiles)
+    objectFile = os.path.splitext(GraphicsBankFile)[0] + '.o'
+
+    try:
+        with open(GraphicsBankInputList, 'r') as file:
+            sameImages = file.read() == '\n'.join(assemblyFiles)
+    except FileNotFoundError:
+        sameImages = False
+
+    if sameImages and os.path.isfile(objectFile) \
+            and all(os.path.getmtime(objectFile) > os.path.getmtime(assemblyFile) for assemblyFile in assemblyFiles):
+        # If the bank was built from the same images after they were last compiled
+        return objectFile
+
+    print('Building Graphics Bank')
+    bankFile, bytesSaved = GraphicsBankConverter(assemblyFiles)
+    print('Shared image data saved %d bytes.' % bytesSaved)
+
+    cmd = [AS] + ASFLAGS + ['-c', bankFile, '-o', objectFile]
+    RunCommand(cmd)
+    return objectFile
 
 
 def ProcessAudio(audioFile: str) -> str:
@@ -366,8 +409,6 @@ def main():
             '**/*.s': ProcessAssembly,
             '**/*.c': ProcessC,
             '**/*.string': ProcessString,
-            '**/*.png': ProcessImage,
-            '**/*.bmp': ProcessImage,
             '**/*.wav': ProcessAudio,
             '**/*.mid': ProcessMusic,
     }
@@ -384,9 +425,10 @@ def main():
     try:
         # Gather source files and process them
         objects = itertools.starmap(RunGlob, globs.items())
+        images = itertools.chain(RunGlob('**/*.png', ProcessImage), RunGlob('**/*.bmp', ProcessImage))
 
         # Link and extract raw binary
-        linked = LinkObjects(itertools.chain.from_iterable(objects))
+        linked = LinkObjects(itertools.chain(itertools.chain.from_iterable(objects), [ProcessMoveTableFlags(), ProcessGraphicsBank(list(images))]))
         Objcopy(linked)
 
     except Exception as e:
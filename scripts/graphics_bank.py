@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+
+import re
+
+GraphicsBankFile = "build/IMG_graphics_bank.s"
+GraphicsBankInputList = "build/IMG_graphics_bank.txt"
+DataSizes = {'.word': 4, '.hword': 2, '.byte': 1}
+
+
+class GraphicsBlock:
+    def __init__(self, section: str, align: str):
+        self.section = section
+        self.align = align
+        self.symbols = []  # Every label pointing at this data
+        self.data = []
+        self.size = 0
+
+    def Key(self) -> (str, str, str):
+        return self.section, self.align, '\n'.join(self.data)
+
+
+def GetGraphicsBlocks(assemblyFile: str) -> [GraphicsBlock]:
+    """Returns the labelled data blocks grit wrote to an assembly file."""
+    blocks = []
+    section = '.section .rodata'
+    align = '.align 2'
+    currentBlock = None
+
+    with open(assemblyFile, 'r') as file:
+        for line in file:
+            line = line.split('@')[0].strip()
+
+            if line.startswith('.section'):
+                section = line
+                currentBlock = None
+            elif line.startswith('.align'):
+                align = line
+                currentBlock = None
+            elif re.match(r'^\w+:$', line):
+                if currentBlock is None or currentBlock.data != []:
+                    currentBlock = GraphicsBlock(section, align)
+                    blocks.append(currentBlock)
+                currentBlock.symbols.append(line[:-1])
+            elif line.split(' ')[0] in DataSizes and currentBlock is not None:
+                directive, values = line.split(None, 1)
+                currentBlock.data.append(directive + ' ' + values)
+                currentBlock.size += DataSizes[directive] * len(values.split(','))
+
+    return blocks
+
+
+def GraphicsBankConverter(assemblyFiles: [str]) -> (str, int):
+    """Merges the grit output for every image into one bank, storing identical
+    tiles, maps, and palettes only once. Returns the bank and the bytes saved."""
+    uniqueBlocks = {}  # Key: block
+    bytesSaved = 0
+
+    for assemblyFile in assemblyFiles:
+        for block in GetGraphicsBlocks(assemblyFile):
+            key = block.Key()
+            if key in uniqueBlocks:
+                uniqueBlocks[key].symbols += block.symbols  # Alias the data already in the bank
+                bytesSaved += block.size
+            else:
+                uniqueBlocks[key] = block
+
+    with open(GraphicsBankFile, 'w') as file:
+        file.write('@Generated by scripts/graphics_bank.py from the images in graphics/. Do not edit.\n')
+
+        for block in uniqueBlocks.values():
+            file.write('\n\t%s\n\t%s\n' % (block.section, block.align))
+            for symbol in block.symbols:
+                file.write('\t.global %s\n' % symbol)
+            for symbol in block.symbols:
+                file.write('%s:\n' % symbol)
+            for data in block.data:
+                file.write('\t%s\n' % data)
+
+    with open(GraphicsBankInputList, 'w') as file:
+        file.write('\n'.join(assemblyFiles))
+
+    return GraphicsBankFile, bytesSaved
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+
+import re
+import sys
+
+MoveTablesAssembly = "assembly/data/move_tables.s"
+MoveTablesHeader = "include/new/move_tables.h"
+MoveTableFlagsFile = "build/move_table_flags.c"
+
+
+def GetMoveTableBits() -> [str]:
+    """Returns the names of the tables in the order of their bits in enum MoveTableBits."""
+    with open(MoveTablesHeader, 'r') as file:
+        header = file.read()
+
+    enum = re.search(r'enum MoveTableBits\s*{(.*?)}', header, re.DOTALL)
+    if enum is None:
+        print('Error: enum MoveTableBits could not be found in ' + MoveTablesHeader + '.')
+        sys.exit(1)
+
+    return re.findall(r'(\w+)Bit,', enum.group(1))
+
+
+def GetMoveTables() -> {str: [str]}:
+    """Returns every table in the move tables file mapped to the moves it contains."""
+    tables = {}
+    currentTable = None
+
+    with open(MoveTablesAssembly, 'r') as file:
+        for line in file:
+            line = line.split('@')[0].strip()
+
+            if line.endswith(':'):
+                currentTable = line[:-1]
+                tables[currentTable] = []
+            elif line.startswith('.hword') and currentTable is not None:
+                move = line.split()[1]
+                if move == 'MOVE_TABLES_TERMIN':
+                    currentTable = None
+                else:
+                    tables[currentTable].append(move)
+
+    return tables
+
+
+def MoveTableFlagsConverter() -> str:
+    """Compiles the move tables into a C file containing a bitfield for each move."""
+    bits = GetMoveTableBits()
+    tables = GetMoveTables()
+    moveFlags = {}  # Move: [flags in word 0, flags in word 1, ...]
+    numWords = (len(bits) + 31) // 32
+
+    for bit, table in enumerate(bits):
+        if table not in tables:
+            print('Error: ' + table + ' is in enum MoveTableBits but not in ' + MoveTablesAssembly + '.')
+            sys.exit(1)
+
+        for move in tables[table]:
+            if move not in moveFlags:
+                moveFlags[move] = [[] for i in range(numWords)]
+
+            if table not in moveFlags[move][bit // 32]:
+                moveFlags[move][bit // 32].append(table)
+
+    stringToWrite = '#include "../include/global.h"\n' \
+                    '#include "../include/new/move_tables.h"\n\n' \
+                    '//Generated by scripts/move_tables.py from ' + MoveTablesAssembly + '. Do not edit.\n\n' \
+                    'const u32 gMoveTableFlags[MOVES_COUNT][NUM_MOVE_TABLE_FLAG_WORDS] =\n{\n'
+
+    for move, words in moveFlags.items():
+        wordStrings = []
+        for word in words:
+            if word == []:
+                wordStrings.append('0')
+            else:
+                wordStrings.append(' | '.join('(1u << (%sBit %% 32))' % table for table in word))
+
+        stringToWrite += '\t[%s] = {%s},\n' % (move, ', '.join(wordStrings))
+
+    stringToWrite += '};\n'
+
+    with open(MoveTableFlagsFile, 'w') as file:
+        file.write(stringToWrite)
+
+    return MoveTableFlagsFile
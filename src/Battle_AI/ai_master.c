@@ -5,6 +5,7 @@
 #include "../../include/new/ai_util.h"
 #include "../../include/new/ai_master.h"
 #include "../../include/new/ai_scripts.h"
+#include "../../include/new/ai_trace.h"
 #include "../../include/new/battle_controller_opponent.h"
 #include "../../include/new/battle_start_turn_start.h"
 #include "../../include/new/battle_util.h"
@@ -352,6 +353,7 @@ u8 BattleAI_ChooseMoveOrAction(void)
 
 	TryTempMegaEvolveBank(gBankAttacker, &backupMonAtk, &backupSpeciesAtk, &backupAbilityAtk);
 
+	AI_TRACE_PHASE_START(timer);
 	if (IS_SINGLE_BATTLE)
 	{
 		TryTempMegaEvolveBank(gBankTarget, &backupMonDef, &backupSpeciesDef, &backupAbilityDef);
@@ -359,6 +361,8 @@ u8 BattleAI_ChooseMoveOrAction(void)
 	}
 	else
 		ret = ChooseMoveOrAction_Doubles(&aiScriptData);
+	AI_TRACE_PHASE_END(timer, AI_TRACE_PHASE_CHOOSE_MOVE, gBankAttacker);
+	AI_TRACE(AI_TRACE_CHOSEN_MOVE, gBankAttacker, gBankTarget, ret, (ret < MAX_MON_MOVES) ? gBattleMons[gBankAttacker].moves[ret] : MOVE_NONE, 0);
 
 	TryRevertTempMegaEvolveBank(gBankAttacker, &backupMonAtk, &backupSpeciesAtk, &backupAbilityAtk);
 	TryRevertTempMegaEvolveBank(gBankTarget, &backupMonDef, &backupSpeciesDef, &backupAbilityDef);
@@ -676,15 +680,21 @@ void AI_TrySwitchOrUseItem(void)
 	//Calulate everything important now to save as much processing time as possible later
 	if (!gNewBS->calculatedAIPredictions) //Only calculate these things once per turn
 	{
-		//mgba_printf(MGBA_LOG_INFO, "Calculating strongest moves...");
+		AI_TRACE_PHASE_START(timer);
 		UpdateStrongestMoves();
-		//mgba_printf(MGBA_LOG_WARN, "Calculating doubles killing moves...");
+		AI_TRACE_PHASE_END(timer, AI_TRACE_PHASE_STRONGEST_MOVES, gActiveBattler);
+
+		AI_TRACE_PHASE_START(timer2);
 		UpdateBestDoublesKillingMoves(); //Takes long time
-		//mgba_printf(MGBA_LOG_INFO, "Predicting moves..");
+		AI_TRACE_PHASE_END(timer2, AI_TRACE_PHASE_DOUBLES_KILLING_MOVES, gActiveBattler);
+
+		AI_TRACE_PHASE_START(timer3);
 		PredictMovesForBanks(); //Takes long time
-		//mgba_printf(MGBA_LOG_WARN, "Calculating Dynamax mon...");
+		AI_TRACE_PHASE_END(timer3, AI_TRACE_PHASE_PREDICT_MOVES, gActiveBattler);
+
+		AI_TRACE_PHASE_START(timer4);
 		RunCalcShouldAIDynamax(); //Allows move predictions to change outcome
-		//mgba_printf(MGBA_LOG_INFO, "Calculating switching...");
+		AI_TRACE_PHASE_END(timer4, AI_TRACE_PHASE_DYNAMAX, gActiveBattler);
 
 		gNewBS->calculatedAIPredictions = TRUE;
 
@@ -715,7 +725,11 @@ void AI_TrySwitchOrUseItem(void)
 	{
 		TryTempMegaEvolveBank(gActiveBattler, &backupMonAtk, &backupSpeciesAtk, &backupAbilityAtk);
 
-		if (ShouldSwitch()) //0x8039A80
+		AI_TRACE_PHASE_START(timer);
+		bool8 shouldSwitch = ShouldSwitch(); //0x8039A80
+		AI_TRACE_PHASE_END(timer, AI_TRACE_PHASE_SWITCHING, gActiveBattler);
+
+		if (shouldSwitch)
 		{
 			if (gBattleStruct->switchoutIndex[SIDE(gActiveBattler)] == PARTY_SIZE)
 			{
@@ -754,6 +768,8 @@ void AI_TrySwitchOrUseItem(void)
 			}
 
 			gBattleStruct->monToSwitchIntoId[gActiveBattler] = gBattleStruct->switchoutIndex[SIDE(gActiveBattler)];
+			AI_TRACE(AI_TRACE_CHOSEN_SWITCH, gActiveBattler, 0xFF, gBattleStruct->monToSwitchIntoId[gActiveBattler],
+					 party[gBattleStruct->monToSwitchIntoId[gActiveBattler]].species, 0);
 			ret = TRUE;
 		}
 		else if (gBattleTypeFlags & BATTLE_TYPE_INGAME_PARTNER && GetBattlerPosition(gActiveBattler) == B_POSITION_PLAYER_RIGHT)
@@ -768,7 +784,6 @@ void AI_TrySwitchOrUseItem(void)
 	}
 
 DONT_THINK:
-	//mgba_printf(MGBA_LOG_INFO, "AI thinking complete.");
 	EmitTwoReturnValues(1, ACTION_USE_MOVE, (gActiveBattler ^ BIT_SIDE) << 8);
 }
 
@@ -1682,7 +1697,7 @@ static bool8 ShouldSwitchIfWonderGuard(void)
 
 		if (!(gBitTable[i] & moveLimitations))
 		{
-			if (CheckTableForMove(move, gMoldBreakerMoves))
+			if (IsMoveInTable(move, gMoldBreakerMoves))
 				return FALSE;
 
 			if (SPLIT(move) != SPLIT_STATUS)
@@ -2252,6 +2267,11 @@ u8 CalcMostSuitableMonToSwitchInto(void)
 		}
 	}
 
+	#ifdef DEBUG_AI_TRACE
+	for (i = firstId; i < lastId; ++i)
+		AI_TRACE(AI_TRACE_SWITCH_CANDIDATE, gActiveBattler, 0xFF, i, party[i].species, scores[i]);
+	#endif
+
 	if (bestMonId != PARTY_SIZE)
 	{
 		if (scores[bestMonId] < 8)
@@ -2500,6 +2520,7 @@ static void PredictMovesForBanks(void)
 						move = TryReplaceMoveWithZMove(bankAtk, bankDef, move);
 						viabilities[i] = AI_Script_Negatives(bankAtk, bankDef, move, 100, &aiScriptData);
 						viabilities[i] = AI_Script_Positives(bankAtk, bankDef, move, viabilities[i], &aiScriptData);
+						AI_TRACE(AI_TRACE_MOVE_VIABILITY, bankAtk, bankDef, i, move, viabilities[i]);
 					}
 
 					AI_THINKING_STRUCT->aiFlags = backupFlags;
@@ -113,7 +113,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 	u8 moveTarget = gBattleMoves[move].target;
 	u8 moveType = GetMoveTypeSpecial(bankAtk, move);
 	u8 moveFlags = gBattleMoves[move].flags;
-	u16 moveAcc = AccuracyCalc(move, bankAtk, bankDef);
+	bool8 wonderSkinAcc = FALSE; //Accuracy is only needed by a few effects, so it's calculated when one of them comes up
 	u16 partnerMove = data->partnerMove;
 	u8 bankAtkPartner = data->bankAtkPartner;
 
@@ -172,19 +172,19 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 	#endif
 
 	// Gravity Table Prevention Check
-	if (IsGravityActive() && CheckTableForMove(move, gGravityBannedMoves))
+	if (IsGravityActive() && IsMoveInTable(move, gGravityBannedMoves))
 		return 0; //Can't select this move period
 
 	// Ungrounded check
-	if (CheckGrounding(bankDef) == IN_AIR && moveType == TYPE_GROUND)
+	if (moveType == TYPE_GROUND && CheckGrounding(bankDef) == IN_AIR)
 		return 0;
 
 	// Powder Move Checks (safety goggles, defender has grass type, overcoat, and powder move table)
-	if (CheckTableForMove(move, gPowderMoves) && !IsAffectedByPowder(bankDef))
+	if (IsMoveInTable(move, gPowderMoves) && !IsAffectedByPowder(bankDef))
 		DECREASE_VIABILITY(10); //No return b/c could be reduced further by absorb abilities
 
 	//Dynamax Check
-	if (IsDynamaxed(bankDef) && CheckTableForMove(move, gDynamaxBannedMoves))
+	if (IsDynamaxed(bankDef) && IsMoveInTable(move, gDynamaxBannedMoves))
 	{
 		DECREASE_VIABILITY(10);
 		return viability; //Move Fails
@@ -293,7 +293,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 				break;
 
 			case ABILITY_BULLETPROOF:
-				if (CheckTableForMove(move, gBallBombMoves))
+				if (IsMoveInTable(move, gBallBombMoves))
 				{
 					DECREASE_VIABILITY(10);
 					return viability;
@@ -310,7 +310,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 				break;
 
 			case ABILITY_AROMAVEIL:
-				if (CheckTableForMove(move, gAromaVeilProtectedMoves))
+				if (IsMoveInTable(move, gAromaVeilProtectedMoves))
 				{
 					DECREASE_VIABILITY(10);
 					return viability;
@@ -421,7 +421,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 
 			case ABILITY_WONDERSKIN:
 				if (moveSplit == SPLIT_STATUS)
-					moveAcc = 50;
+					wonderSkinAcc = TRUE;
 				break;
 
 			case ABILITY_LEAFGUARD:
@@ -481,7 +481,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 					break;
 
 				case ABILITY_AROMAVEIL:
-					if (CheckTableForMove(move, gAromaVeilProtectedMoves))
+					if (IsMoveInTable(move, gAromaVeilProtectedMoves))
 					{
 						DECREASE_VIABILITY(10);
 						return viability;
@@ -514,7 +514,7 @@ u8 AI_Script_Negatives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 	#endif
 
 	//Terrain Check
-	if (CheckGrounding(bankDef) == GROUNDED)
+	if (gTerrainType != NO_TERRAIN && CheckGrounding(bankDef) == GROUNDED)
 	{
 		switch (gTerrainType) {
 			case ELECTRIC_TERRAIN:
@@ -555,10 +555,10 @@ MOVESCR_CHECK_0:
 	//Raid Battle Check
 	if (IsRaidBattle())
 	{
-		if (CheckTableForMove(move, gRaidBattleBannedMoves))
+		if (IsMoveInTable(move, gRaidBattleBannedMoves))
 			return 0; //This move won't work at all.
 
-		if (GetBattlerPosition(bankAtk) == B_POSITION_OPPONENT_LEFT && CheckTableForMove(move, gRaidBattleBannedRaidMonMoves))
+		if (GetBattlerPosition(bankAtk) == B_POSITION_OPPONENT_LEFT && IsMoveInTable(move, gRaidBattleBannedRaidMonMoves))
 			return 0; //This move really shouldn't be used
 
 		if (bankAtk != bankDef
@@ -671,7 +671,7 @@ MOVESCR_CHECK_0:
 					COPYCAT_CHECK_LAST_MOVE:
 						if (gNewBS->LastUsedMove == MOVE_NONE
 						|| gNewBS->LastUsedMove == 0xFFFF
-						|| CheckTableForMove(gNewBS->LastUsedMove, gCopycatBannedMoves)
+						|| IsMoveInTable(gNewBS->LastUsedMove, gCopycatBannedMoves)
 						|| FindMovePositionInMoveset(gNewBS->LastUsedMove, bankAtk) < 4) //If you have the move, use it directly
 							DECREASE_VIABILITY(10);
 						else
@@ -681,7 +681,7 @@ MOVESCR_CHECK_0:
 					{
 						if (predictedMove == MOVE_NONE)
 							goto COPYCAT_CHECK_LAST_MOVE;
-						else if (CheckTableForMove(predictedMove, gCopycatBannedMoves)
+						else if (IsMoveInTable(predictedMove, gCopycatBannedMoves)
 							 || FindMovePositionInMoveset(predictedMove, bankAtk) < 4)
 						{
 							DECREASE_VIABILITY(10);
@@ -1098,7 +1098,7 @@ MOVESCR_CHECK_0:
 		case EFFECT_RECOIL_IF_MISS:
 			if (data->atkAbility == ABILITY_MAGICGUARD)
 				goto AI_STANDARD_DAMAGE;
-			else if (moveAcc < 75)
+			else if ((wonderSkinAcc ? 50 : AccuracyCalc(move, bankAtk, bankDef)) < 75)
 				DECREASE_VIABILITY(6);
 			break;
 
@@ -1120,17 +1120,17 @@ MOVESCR_CHECK_0:
 
 			u32 dmg = GetFinalAIMoveDamage(move, bankAtk, bankDef, 1, NULL);
 
-			if (CheckTableForMove(move, gPercent25RecoilMoves))
+			if (IsMoveInTable(move, gPercent25RecoilMoves))
 				dmg = MathMax(1, dmg / 4);
-			else if (CheckTableForMove(move, gPercent33RecoilMoves))
+			else if (IsMoveInTable(move, gPercent33RecoilMoves))
 				dmg = MathMax(1, dmg / 3);
-			else if (CheckTableForMove(move, gPercent50RecoilMoves))
+			else if (IsMoveInTable(move, gPercent50RecoilMoves))
 				dmg = MathMax(1, dmg / 2);
-			else if (CheckTableForMove(move, gPercent66RecoilMoves))
+			else if (IsMoveInTable(move, gPercent66RecoilMoves))
 				dmg = MathMax(1, (dmg * 2) / 3);
-			else if (CheckTableForMove(move, gPercent75RecoilMoves))
+			else if (IsMoveInTable(move, gPercent75RecoilMoves))
 				dmg = MathMax(1, (dmg * 3) / 4);
-			else if (CheckTableForMove(move, gPercent100RecoilMoves))
+			else if (IsMoveInTable(move, gPercent100RecoilMoves))
 				dmg = MathMax(1, dmg);
 			else if (move == MOVE_MINDBLOWN || move == MOVE_STEELBEAM)
 			{
@@ -2610,9 +2610,9 @@ MOVESCR_CHECK_0:
 
 					if (instructedMove == MOVE_NONE
 					||  IsDynamaxed(bankDef)
-					||  CheckTableForMove(instructedMove, gInstructBannedMoves)
-					||  CheckTableForMove(instructedMove, gMovesThatRequireRecharging)
-					||  CheckTableForMove(instructedMove, gMovesThatCallOtherMoves)
+					||  IsMoveInTable(instructedMove, gInstructBannedMoves)
+					||  IsMoveInTable(instructedMove, gMovesThatRequireRecharging)
+					||  IsMoveInTable(instructedMove, gMovesThatCallOtherMoves)
 					|| (IsZMove(instructedMove))
 					|| (gLockedMoves[bankDef] != 0 && gLockedMoves[bankDef] != 0xFFFF)
 					||  gBattleMons[bankDef].status2 & STATUS2_MULTIPLETURNS
@@ -116,7 +116,7 @@ u8 AI_Script_Positives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 					COPYCAT_CHECK_LAST_MOVE:
 						if (gNewBS->LastUsedMove != MOVE_NONE
 						&& gNewBS->LastUsedMove != 0xFFFF
-						&& !CheckTableForMove(gNewBS->LastUsedMove, gCopycatBannedMoves)
+						&& !IsMoveInTable(gNewBS->LastUsedMove, gCopycatBannedMoves)
 						&& !MoveInMoveset(gNewBS->LastUsedMove, bankAtk)) //If you have the move, use it directly
 							return AI_Script_Positives(bankAtk, bankDef, gNewBS->LastUsedMove, originalViability, data);
 					}
@@ -124,7 +124,7 @@ u8 AI_Script_Positives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 					{
 						if (predictedMove == MOVE_NONE)
 							goto COPYCAT_CHECK_LAST_MOVE;
-						else if (!CheckTableForMove(predictedMove, gCopycatBannedMoves)
+						else if (!IsMoveInTable(predictedMove, gCopycatBannedMoves)
 							 &&  !MoveInMoveset(predictedMove, bankAtk))
 						{
 							return AI_Script_Positives(bankAtk, bankDef, predictedMove, originalViability, data);
@@ -2354,7 +2354,7 @@ u8 AI_Script_Positives(const u8 bankAtk, const u8 bankDef, const u16 originalMov
 		}
 	}
 
-	if (data->atkStatus1 & STATUS1_FREEZE && CheckTableForMove(move, gMovesCanUnfreezeAttacker))
+	if (data->atkStatus1 & STATUS1_FREEZE && IsMoveInTable(move, gMovesCanUnfreezeAttacker))
 	{
 		//Unfreeze yourself
 		if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
@@ -0,0 +1,45 @@
+#include "../defines.h"
+#include "../defines_battle.h"
+#include "../../include/gba/io_reg.h"
+
+#include "../../include/new/ai_trace.h"
+/*
+ai_trace.c
+	records the AI's decisions and how long each phase of its thinking took
+*/
+
+#define gAITrace ((struct AITrace*) 0x203EB08)
+
+#ifdef DEBUG_AI_TRACE
+//This file's functions:
+static void TryInitAITrace(void);
+
+static void TryInitAITrace(void)
+{
+	if (gAITrace->magic != AI_TRACE_MAGIC)
+	{
+		Memset(gAITrace, 0, sizeof(struct AITrace));
+		gAITrace->magic = AI_TRACE_MAGIC;
+	}
+}
+
+void AITrace_Record(u8 type, u8 bankAtk, u8 bankDef, u8 index, u16 value, s16 score, u16 ticks, u32 frames)
+{
+	TryInitAITrace();
+
+	struct AITraceRecord* record = &gAITrace->records[gAITrace->next];
+	record->type = type;
+	record->bankAtk = bankAtk;
+	record->bankDef = bankDef;
+	record->index = index;
+	record->value = value;
+	record->score = score;
+	record->ticks = ticks;
+	record->frames = MathMin(frames, 0xFF);
+	record->turn = gBattleResults.battleTurnCounter;
+
+	gAITrace->next = (gAITrace->next + 1) % AI_TRACE_NUM_RECORDS;
+	if (gAITrace->total < 0xFFFF)
+		++gAITrace->total;
+}
+#endif
@@ -30,6 +30,9 @@ ai_util.c
 
 //This file's functions:
 static u32 CalcPredictedDamageForCounterMoves(u16 move, u8 bankAtk, u8 bankDef);
+static u8 AdjustHitsForBreakingProtection(u16 move, u8 bankAtk, u8 bankDef, u8 numHits);
+static void GetMoveDamageRolls(u16 move, u8 bankAtk, u8 bankDef, u32* damage, u32* maxRollDamage);
+static u8 CalcKOChanceFromRolls(u16 move, u8 bankAtk, u8 atkAbility, u8 bankDef, u8 numHits, u32 damage, u32 maxRollDamage);
 
 bool8 CanKillAFoe(u8 bank)
 {
@@ -717,7 +720,7 @@ bool8 RangeMoveCanHurtPartner(u16 move, u8 bankAtk, u8 bankAtkPartner)
 		&& !(AI_SpecialTypeCalc(move, bankAtk, bankAtkPartner) & MOVE_RESULT_NO_EFFECT); //Move has effect
 }
 
-static bool8 CalculateMoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
+static u8 AdjustHitsForBreakingProtection(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
 {
 	u8 ability = ABILITY(bankDef);
 	u16 species = SPECIES(bankDef);
@@ -736,10 +739,98 @@ static bool8 CalculateMoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 nu
 			numHits -= 1; //Takes at least a hit to break Disguise/Ice Face or sub
 	}
 
-	if (GetFinalAIMoveDamage(move, bankAtk, bankDef, numHits, NULL) >= gBattleMons[bankDef].hp)
-		return TRUE;
+	return numHits;
+}
 
-	return FALSE;
+static bool8 CalculateMoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
+{
+	return GetMoveKOChance(move, bankAtk, bankDef, numHits) >= AI_KO_CHANCE_THRESHOLD;
+}
+
+//Returns the percent chance the move knocks out the target in numHits uses,
+//counting every random damage roll instead of only the AI's usual 93% roll
+u8 GetMoveKOChance(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
+{
+	u32 damage, maxRollDamage;
+
+	numHits = AdjustHitsForBreakingProtection(move, bankAtk, bankDef, numHits);
+	if (numHits == 0 || gBattleMons[bankDef].hp == 0)
+		return 0;
+
+	GetMoveDamageRolls(move, bankAtk, bankDef, &damage, &maxRollDamage);
+	return CalcKOChanceFromRolls(move, bankAtk, ABILITY(bankAtk), bankDef, numHits, damage, maxRollDamage);
+}
+
+//Gets the damage of a single use and the highest roll it was taken from,
+//sharing the damage calc with GetFinalAIMoveDamage when the move is in the moveset
+static void GetMoveDamageRolls(u16 move, u8 bankAtk, u8 bankDef, u32* damage, u32* maxRollDamage)
+{
+	struct DamageCalc damageData = {0};
+	u8 movePos = FindMovePositionInMoveset(move, bankAtk);
+
+	if (movePos < MAX_MON_MOVES) //Both caches are always filled by the same calc
+	{
+		*damage = GetFinalAIMoveDamage(move, bankAtk, bankDef, 1, NULL);
+		*maxRollDamage = gNewBS->ai.maxRollDamageByMove[bankAtk][bankDef][movePos];
+		return;
+	}
+
+	*damage = CalcFinalAIMoveDamage(move, bankAtk, bankDef, 1, &damageData);
+	*maxRollDamage = damageData.maxRollDamage;
+}
+
+static u8 CalcKOChanceFromRolls(u16 move, u8 bankAtk, u8 atkAbility, u8 bankDef, u8 numHits, u32 damage, u32 maxRollDamage)
+{
+	u32 i, j, firstHit, laterHit, koCount;
+	u32 rolls[16];
+	u16 defHP = gBattleMons[bankDef].hp;
+	u8 defAbility = ABILITY(bankDef);
+	bool8 multiHit = FALSE;
+	bool8 survivesFirstHit, laterHitsBoosted;
+
+	if (maxRollDamage == 0) //Damage doesn't depend on a random roll
+		return (MathMin(damage * numHits, gBattleMons[bankDef].maxHP) >= defHP) ? 100 : 0;
+
+	//Build every possible damage roll from the one calculation
+	for (i = 0; i < ARRAY_COUNT(rolls); ++i)
+	{
+		damage = MathMax(1, (maxRollDamage * (85 + i)) / 100);
+		multiHit = AI_AdjustDamageForMultiHits(&damage, move, bankAtk, atkAbility);
+		rolls[i] = damage;
+	}
+
+	survivesFirstHit = !multiHit
+					&& (gBattleMoves[move].effect == EFFECT_FALSE_SWIPE
+					 || (BATTLER_MAX_HP(bankDef) && defAbility == ABILITY_STURDY && NO_MOLD_BREAKERS(atkAbility, move))
+					 || (BATTLER_MAX_HP(bankDef) && IsBankHoldingFocusSash(bankDef)));
+
+	laterHitsBoosted = BATTLER_MAX_HP(bankDef) && (defAbility == ABILITY_MULTISCALE || defAbility == ABILITY_SHADOWSHIELD);
+
+	koCount = 0;
+	for (i = 0; i < ARRAY_COUNT(rolls); ++i)
+	{
+		firstHit = rolls[i];
+		if (survivesFirstHit)
+			firstHit = MathMin(firstHit, defHP - 1);
+
+		if (numHits == 1)
+		{
+			koCount += (firstHit >= defHP);
+			continue;
+		}
+
+		//Any hits after the second are assumed to get the same roll as the second
+		for (j = 0; j < ARRAY_COUNT(rolls); ++j)
+		{
+			laterHit = (laterHitsBoosted) ? rolls[j] * 2 : rolls[j];
+			koCount += (firstHit + laterHit * (numHits - 1) >= defHP);
+		}
+	}
+
+	if (numHits == 1)
+		return (koCount * 100) / ARRAY_COUNT(rolls);
+
+	return (koCount * 100) / (ARRAY_COUNT(rolls) * ARRAY_COUNT(rolls));
 }
 
 bool8 MoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
@@ -771,6 +862,7 @@ bool8 MoveKnocksOutXHits(u16 move, u8 bankAtk, u8 bankDef, u8 numHits)
 
 bool8 MoveKnocksOutXHitsFromParty(u16 move, struct Pokemon* monAtk, u8 bankDef, u8 numHits, struct DamageCalc* damageData)
 {
+	u32 damage;
 	u8 ability = ABILITY(bankDef);
 	u16 species = SPECIES(bankDef);
 	bool8 noMoldBreakers = NO_MOLD_BREAKERS(GetMonAbility(monAtk), move);
@@ -788,10 +880,12 @@ bool8 MoveKnocksOutXHitsFromParty(u16 move, struct Pokemon* monAtk, u8 bankDef,
 			numHits -= 1; //Takes at least a hit to break Disguise/Ice Face or sub
 	}
 
-	if (CalcFinalAIMoveDamageFromParty(move, monAtk, bankDef, numHits, damageData) >= gBattleMons[bankDef].hp)
-		return TRUE;
+	if (numHits == 0 || gBattleMons[bankDef].hp == 0)
+		return FALSE;
 
-	return FALSE;
+	damageData->maxRollDamage = 0; //Not every calc sets it
+	damage = CalcFinalAIMoveDamageFromParty(move, monAtk, bankDef, 1, damageData);
+	return CalcKOChanceFromRolls(move, FOE(bankDef), GetMonAbility(monAtk), bankDef, numHits, damage, damageData->maxRollDamage) >= AI_KO_CHANCE_THRESHOLD;
 }
 
 static bool8 MoveKnocksOutAfterDynamax(u16 move, u8 bankAtk, u8 bankDef)
@@ -860,12 +954,18 @@ u16 CalcFinalAIMoveDamage(u16 move, u8 bankAtk, u8 bankDef, u8 numHits, struct D
 
 u32 GetFinalAIMoveDamage(u16 move, u8 bankAtk, u8 bankDef, u8 numHits, struct DamageCalc* damageData)
 {
+	struct DamageCalc data = {0};
 	u8 movePos = FindMovePositionInMoveset(move, bankAtk);
 	if (movePos < MAX_MON_MOVES) //Move in moveset
 	{
 		if (gNewBS->ai.damageByMove[bankAtk][bankDef][movePos] != 0xFFFFFFFF)
 			return gNewBS->ai.damageByMove[bankAtk][bankDef][movePos] * numHits;
+
+		if (damageData == NULL)
+			damageData = &data;
+		damageData->maxRollDamage = 0; //Not every calc sets it
 		gNewBS->ai.damageByMove[bankAtk][bankDef][movePos] = CalcFinalAIMoveDamage(move, bankAtk, bankDef, 1, damageData);
+		gNewBS->ai.maxRollDamageByMove[bankAtk][bankDef][movePos] = damageData->maxRollDamage; //Cache the roll from the same calc
 		return gNewBS->ai.damageByMove[bankAtk][bankDef][movePos] * numHits;
 	}
 
@@ -955,6 +1055,7 @@ move_t CalcStrongestMove(const u8 bankAtk, const u8 bankDef, const bool8 onlySpr
 
 		if (!(gBitTable[i] & moveLimitations))
 		{
+			damageData.maxRollDamage = 0; //Not every branch below calculates it
 			if (gBattleMoves[move].power == 0
 			||  (onlySpreadMoves && !(gBattleMoves[move].target & (MOVE_TARGET_BOTH | MOVE_TARGET_ALL))))
 				continue;
@@ -972,6 +1073,7 @@ move_t CalcStrongestMove(const u8 bankAtk, const u8 bankDef, const bool8 onlySpr
 			{
 				gNewBS->ai.moveKnocksOut1Hit[bankAtk][bankDef][i] = FALSE;
 				gNewBS->ai.damageByMove[bankAtk][bankDef][i] = 0;
+				gNewBS->ai.maxRollDamageByMove[bankAtk][bankDef][i] = 0;
 				if (gBattleMons[bankAtk].level <= gBattleMons[bankDef].level)
 					continue;
 				if (move == MOVE_SHEERCOLD && IsOfType(bankDef, TYPE_ICE))
@@ -1013,7 +1115,8 @@ move_t CalcStrongestMove(const u8 bankAtk, const u8 bankDef, const bool8 onlySpr
 			}
 
 			gNewBS->ai.damageByMove[bankAtk][bankDef][i] = predictedDamage;
-			if (predictedDamage >= defHP)
+			gNewBS->ai.maxRollDamageByMove[bankAtk][bankDef][i] = damageData.maxRollDamage;
+			if (CalcKOChanceFromRolls(move, bankAtk, ABILITY(bankAtk), bankDef, 1, predictedDamage, damageData.maxRollDamage) >= AI_KO_CHANCE_THRESHOLD)
 				gNewBS->ai.moveKnocksOut1Hit[bankAtk][bankDef][i] = TRUE;
 			else
 				gNewBS->ai.moveKnocksOut1Hit[bankAtk][bankDef][i] = FALSE;
@@ -1059,17 +1162,17 @@ bool8 MoveWillHit(u16 move, u8 bankAtk, u8 bankDef)
 	||  (gStatuses3[bankDef] & STATUS3_ALWAYS_HITS && gDisableStructs[bankDef].bankWithSureHit == bankAtk))
 		return TRUE;
 
-	if (((gStatuses3[bankDef] & (STATUS3_IN_AIR | STATUS3_SKY_DROP_ATTACKER | STATUS3_SKY_DROP_TARGET)) && !CheckTableForMove(move, gIgnoreInAirMoves))
-	||  ((gStatuses3[bankDef] & STATUS3_UNDERGROUND) && !CheckTableForMove(move, gIgnoreUndergoundMoves))
-	||  ((gStatuses3[bankDef] & STATUS3_UNDERWATER) && !CheckTableForMove(move, gIgnoreUnderwaterMoves))
+	if (((gStatuses3[bankDef] & (STATUS3_IN_AIR | STATUS3_SKY_DROP_ATTACKER | STATUS3_SKY_DROP_TARGET)) && !IsMoveInTable(move, gIgnoreInAirMoves))
+	||  ((gStatuses3[bankDef] & STATUS3_UNDERGROUND) && !IsMoveInTable(move, gIgnoreUndergoundMoves))
+	||  ((gStatuses3[bankDef] & STATUS3_UNDERWATER) && !IsMoveInTable(move, gIgnoreUnderwaterMoves))
 	||   (gStatuses3[bankDef] & STATUS3_DISAPPEARED))
 		return FALSE;
 
 	if ((move == MOVE_TOXIC && IsOfType(bankAtk, TYPE_POISON))
-	||  (CheckTableForMove(move, gAlwaysHitWhenMinimizedMoves) && gStatuses3[bankDef] & STATUS3_MINIMIZED)
+	||  (IsMoveInTable(move, gAlwaysHitWhenMinimizedMoves) && gStatuses3[bankDef] & STATUS3_MINIMIZED)
 	|| ((gStatuses3[bankDef] & STATUS3_TELEKINESIS) && gBattleMoves[move].effect != EFFECT_0HKO)
 	||  gBattleMoves[move].accuracy == 0
-	|| (WEATHER_HAS_EFFECT && (gBattleWeather & WEATHER_RAIN_ANY) && CheckTableForMove(move, gAlwaysHitInRainMoves))
+	|| (WEATHER_HAS_EFFECT && (gBattleWeather & WEATHER_RAIN_ANY) && IsMoveInTable(move, gAlwaysHitInRainMoves))
 	||  IsZMove(move)
 	||  IsAnyMaxMove(move))
 		return TRUE;
@@ -2370,7 +2473,7 @@ bool8 UnfreezingMoveInMoveset(u8 bank)
 
 		if (!(gBitTable[i] & moveLimitations))
 		{
-			if (CheckTableForMove(move, gMovesCanUnfreezeAttacker))
+			if (IsMoveInTable(move, gMovesCanUnfreezeAttacker))
 				return TRUE;
 		}
 	}
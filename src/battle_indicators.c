@@ -10,6 +10,7 @@
 #include "../include/new/mega.h"
 #include "../include/new/move_menu.h"
 #include "../include/new/set_z_effect.h"
+#include "../include/new/sprite_filter.h"
 
 extern const u8 Mega_IndicatorTiles[];
 extern const u8 Alpha_IndicatorTiles[];
@@ -29,8 +30,7 @@ extern const u8 Raid_ShieldTiles[];
 
 static bool8 IsIgnoredTriggerColour(u16 colour);
 static struct Sprite* GetHealthboxSprite(u8 bank);
-static u16 ConvertColorToGrayscale(u16 colour);
-static u16 LightUpTriggerSymbol(u16 clra);
+static void UpdateTriggerPosition(struct Sprite* self);
 static void SpriteCB_MegaTrigger(struct Sprite* self);
 static void SpriteCB_MegaIndicator(struct Sprite* self);
 static void SpriteCB_ZTrigger(struct Sprite* self);
@@ -267,61 +267,15 @@ static struct Sprite* GetHealthboxSprite(u8 bank)
 	return &gSprites[gHealthboxSpriteIds[bank]];
 }
 
-static u16 ConvertColorToGrayscale(u16 colour)
-{
-	s32 r = colour & 31;
-	s32 g = (colour >> 5) & 31;
-	s32 b = (colour >> 10) & 31;
-	s32 gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
-	return RGB2(gray, gray, gray);
-}
-
-static u16 LightUpTriggerSymbol(u16 clra)
-{
-	u16 clrb = 0x7FFF;
-
-	u32 currentAlpha  = 20;
-
-	const u32 rbmask= ((0x1F)|(0x1F << 10)), gmask= 0x1F << 5;
-	const u32 rbhalf= 0x4010, ghalf= 0x0200;
-
-	// Red and blue
-	u32 parta = clra & rbmask;
-	u32 partb = clrb & rbmask;
-	u32 part = (partb-parta) * (32 - ((currentAlpha < 0x100) ? currentAlpha : currentAlpha >> 12)) + parta*32 + rbhalf;
-	u16 clr = (part >> 5) & rbmask;
-
-	// Green
-	parta = clra & gmask;
-	partb = clrb & gmask;
-	part = (partb-parta) * (32 - ((currentAlpha < 0x100) ? currentAlpha : currentAlpha >> 12)) + parta*32 + ghalf;
-	clr |= (part >> 5) & gmask;
-
-	return clr;
-}
+#define LIGHT_UP_TRIGGER_SYMBOL(colour) TintColour(colour, RGB_WHITE, 12) //12/32 of the way to white
 
 #define TRIGGER_BANK self->data[4]
 #define PALETTE_STATE self->data[1]
 #define TAG self->template->tileTag
 #define PAL_TAG self->template->paletteTag
 
-static void SpriteCB_MegaTrigger(struct Sprite* self)
+static void UpdateTriggerPosition(struct Sprite* self)
 {
-	if (TAG == GFX_TAG_MEGA_TRIGGER)
-	{
-		if (!CanMegaEvolve(TRIGGER_BANK, FALSE) || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
-			self->invisible = TRUE;
-		else
-			self->invisible = FALSE;
-	}
-	else //Ultra Burst
-	{
-		if (!CanMegaEvolve(TRIGGER_BANK, TRUE) || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
-			self->invisible = TRUE;
-		else
-			self->invisible = FALSE;
-	}
-
 	s16 xshift, yshift;
 	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
 	{
@@ -338,15 +292,11 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 	}
 
 	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxSpriteIds[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
-
-	u8 y = healthbox->oam.y;
+	struct Sprite* healthbox = GetHealthboxSprite(TRIGGER_BANK);
 
-	if (y)
+	if (healthbox->oam.y)
 	{
 		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
 		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
 		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
 	}
@@ -355,6 +305,18 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 		// The box is offscreen, so hide this one as well
 		self->pos1.x = -32;
 	}
+}
+
+static void SpriteCB_MegaTrigger(struct Sprite* self)
+{
+	const struct Evolution* evo = CanMegaEvolve(TRIGGER_BANK, TAG != GFX_TAG_MEGA_TRIGGER); //Ultra Burst for the other tag
+
+	if (evo == NULL || gBattleSpritesDataPtr->bankData[TRIGGER_BANK].transformSpecies)
+		self->invisible = TRUE;
+	else
+		self->invisible = FALSE;
+
+	UpdateTriggerPosition(self);
 
 	if (gBattlerControllerFuncs[TRIGGER_BANK] == (void*) (0x0802EA10 | 1) //Old HandleInputChooseMove
 	||  gBattlerControllerFuncs[TRIGGER_BANK] == HandleInputChooseMove
@@ -381,11 +343,9 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 		}
 	}
 
-	const struct Evolution* evo;
 	struct ChooseMoveStruct* moveInfo = (struct ChooseMoveStruct*) (&gBattleBufferA[TRIGGER_BANK][4]);
 	if (TAG == GFX_TAG_MEGA_TRIGGER)
 	{
-		evo = CanMegaEvolve(TRIGGER_BANK, FALSE);
 		if (evo->unknown != MEGA_VARIANT_ULTRA_BURST)
 		{
 			if (!moveInfo->canMegaEvolve)
@@ -401,7 +361,6 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 	}
 	else //TAG == GFX_TAG_ULTRA_TRIGGER
 	{
-		evo = CanMegaEvolve(TRIGGER_BANK, TRUE);
 		if (evo->unknown == MEGA_VARIANT_ULTRA_BURST)
 		{
 			if (!moveInfo->canMegaEvolve)
@@ -428,13 +387,13 @@ static void SpriteCB_MegaTrigger(struct Sprite* self)
 
 			switch(PALETTE_STATE) {
 				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Mega_TriggerPal[i]);
+					pal[i] = LIGHT_UP_TRIGGER_SYMBOL(Mega_TriggerPal[i]);
 					break;
 				case MegaTriggerNormalColour:
 					pal[i] = Mega_TriggerPal[i];
 					break;
 				case MegaTriggerGrayscale:
-					pal[i] = ConvertColorToGrayscale(Mega_TriggerPal[i]);
+					pal[i] = GrayscaleColour(Mega_TriggerPal[i]);
 					break;
 			}
 		}
@@ -519,9 +478,9 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 		else
 			shift += 26;
 
-		// Convert the level to a string to get how long it is
-		u8 buf[10];
-		u8 stringlen = ConvertIntToDecimalStringN(buf, GetBankPartyData(INDICATOR_BANK)->level, 0, 3) - buf;
+		// Get how many digits the level is drawn with
+		u8 level = GetBankPartyData(INDICATOR_BANK)->level;
+		u8 stringlen = (level >= 100) ? 3 : (level >= 10) ? 2 : 1;
 
 		// The x position depends on the X origin of the healthbox as well as
 		// the string length
@@ -561,39 +520,7 @@ static void SpriteCB_MegaIndicator(struct Sprite* self)
 
 static void SpriteCB_ZTrigger(struct Sprite* self)
 {
-	s16 xshift, yshift;
-	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
-	{
-		xshift = -6;
-		yshift = -2;
-
-		if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
-			xshift -= 8;
-	}
-	else
-	{
-		xshift = -5;
-		yshift = 1;
-	}
-
-	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxSpriteIds[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
-
-	u8 y = healthbox->oam.y;
-
-	if (y)
-	{
-		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
-		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
-		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
-	}
-	else
-	{
-		// The box is offscreen, so hide this one as well
-		self->pos1.x = -32;
-	}
+	UpdateTriggerPosition(self);
 
 	if (gBattlerControllerFuncs[TRIGGER_BANK] == (void*) (0x0802EA10 | 1) //Old HandleInputChooseMove
 	||  gBattlerControllerFuncs[TRIGGER_BANK] == HandleInputChooseMove
@@ -649,7 +576,7 @@ static void SpriteCB_ZTrigger(struct Sprite* self)
 
 			switch(PALETTE_STATE) {
 				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Z_Move_TriggerPal[i]);
+					pal[i] = LIGHT_UP_TRIGGER_SYMBOL(Z_Move_TriggerPal[i]);
 					break;
 				case MegaTriggerNormalColour:
 					pal[i] = Z_Move_TriggerPal[i];
@@ -663,40 +590,7 @@ static void SpriteCB_ZTrigger(struct Sprite* self)
 
 static void SpriteCB_DynamaxTrigger(struct Sprite* self)
 {
-	s16 xshift, yshift;
-
-	if (gBattleTypeFlags & BATTLE_TYPE_DOUBLE)
-	{
-		xshift = -6;
-		yshift = -2;
-
-		if (IndexOfSpritePaletteTag(TYPE_ICON_TAG) != 0xFF) //Type icons are shown
-			xshift -= 8;
-	}
-	else
-	{
-		xshift = -5;
-		yshift = 1;
-	}
-
-	// Find the health box object that this trigger is supposed to be attached to
-	u8 id = gHealthboxSpriteIds[TRIGGER_BANK];
-	struct Sprite* healthbox = &gSprites[id];
-
-	u8 y = healthbox->oam.y;
-
-	if (y)
-	{
-		// Copy the healthbox's position (it has various animations)
-		//self->y = healthbox->y + 20;
-		self->pos1.x = (healthbox->oam.x) + xshift + self->data[3];
-		self->pos1.y = healthbox->pos1.y + yshift + healthbox->pos2.y;
-	}
-	else
-	{
-		// The box is offscreen, so hide this one as well
-		self->pos1.x = -32;
-	}
+	UpdateTriggerPosition(self);
 
 	if (gBattlerControllerFuncs[TRIGGER_BANK] == (void*) (0x0802EA10 | 1) //Old HandleInputChooseMove
 	||  gBattlerControllerFuncs[TRIGGER_BANK] == HandleInputChooseMove
@@ -751,7 +645,7 @@ static void SpriteCB_DynamaxTrigger(struct Sprite* self)
 
 			switch(PALETTE_STATE) {
 				case MegaTriggerLightUp:
-					pal[i] = LightUpTriggerSymbol(Dynamax_TriggerPal[i]);
+					pal[i] = LIGHT_UP_TRIGGER_SYMBOL(Dynamax_TriggerPal[i]);
 					break;
 				case MegaTriggerNormalColour:
 					pal[i] = Dynamax_TriggerPal[i];
@@ -0,0 +1,111 @@
+#include "defines.h"
+#include "defines_battle.h"
+#include "../include/random.h"
+
+#include "../include/new/battle_replay.h"
+/*
+battle_replay.c
+	records the seed and inputs of a battle so it can be played back frame for frame
+*/
+
+#define gBattleReplay ((struct BattleReplay*) 0x203EE10)
+
+#ifdef DEBUG_BATTLE_REPLAY
+//This file's functions:
+static void RecordBattleKeys(u16 keys);
+static u16 ReplayBattleKeys(u16 liveKeys);
+
+void StartBattleReplay(void)
+{
+	if (gBattleTypeFlags & BATTLE_TYPE_LINK)
+		return; //The seed is shared with the other player
+
+	if (gBattleReplay->magic == BATTLE_REPLAY_MAGIC
+	&& gBattleReplay->mode == BATTLE_REPLAY_PLAY_NEXT_BATTLE)
+	{
+		gRngValue = gBattleReplay->seed;
+		gBattleReplay->mode = BATTLE_REPLAY_PLAYING;
+		gBattleReplay->playbackRun = 0;
+		gBattleReplay->playbackFrame = 0;
+	}
+	else
+	{
+		Memset(gBattleReplay, 0, sizeof(struct BattleReplay));
+		gBattleReplay->magic = BATTLE_REPLAY_MAGIC;
+		gBattleReplay->seed = gRngValue;
+		gBattleReplay->mode = BATTLE_REPLAY_RECORDING;
+	}
+
+	gBattleReplay->framesInBattle = 0;
+}
+
+u16 TryRecordOrReplayBattleKeys(u16 keys)
+{
+	if (gBattleReplay->magic != BATTLE_REPLAY_MAGIC)
+		return keys;
+
+	switch (gBattleReplay->mode) {
+		case BATTLE_REPLAY_RECORDING:
+		case BATTLE_REPLAY_PLAYING:
+			if (!gMain.inBattle)
+			{
+				if (gBattleReplay->framesInBattle > 0) //Battle is over
+					gBattleReplay->mode = BATTLE_REPLAY_IDLE;
+				break;
+			}
+
+			++gBattleReplay->framesInBattle;
+			if (gBattleReplay->mode == BATTLE_REPLAY_RECORDING)
+				RecordBattleKeys(keys);
+			else
+				keys = ReplayBattleKeys(keys);
+			break;
+	}
+
+	return keys;
+}
+
+static void RecordBattleKeys(u16 keys)
+{
+	struct BattleReplayKeyRun* run;
+
+	if (gBattleReplay->numRuns > 0)
+	{
+		run = &gBattleReplay->runs[gBattleReplay->numRuns - 1];
+		if (run->keys == keys && run->frames < 0xFFFF) //Still holding the same keys
+		{
+			++run->frames;
+			return;
+		}
+	}
+
+	if (gBattleReplay->numRuns < BATTLE_REPLAY_NUM_RUNS)
+	{
+		run = &gBattleReplay->runs[gBattleReplay->numRuns++];
+		run->keys = keys;
+		run->frames = 1;
+	}
+	else //Out of space
+	{
+		gBattleReplay->overflowed = TRUE;
+		gBattleReplay->mode = BATTLE_REPLAY_IDLE;
+	}
+}
+
+static u16 ReplayBattleKeys(u16 liveKeys)
+{
+	if (gBattleReplay->playbackRun >= gBattleReplay->numRuns)
+		return liveKeys; //Recording ended, so let the player take over
+
+	struct BattleReplayKeyRun* run = &gBattleReplay->runs[gBattleReplay->playbackRun];
+	u16 keys = run->keys;
+
+	if (++gBattleReplay->playbackFrame >= run->frames)
+	{
+		++gBattleReplay->playbackRun;
+		gBattleReplay->playbackFrame = 0;
+	}
+
+	return keys;
+}
+#endif
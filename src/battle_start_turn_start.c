@@ -12,6 +12,7 @@
 #include "../include/new/ai_master.h"
 #include "../include/new/battle_start_turn_start.h"
 #include "../include/new/battle_start_turn_start_battle_scripts.h"
+#include "../include/new/battle_replay.h"
 #include "../include/new/battle_transition.h"
 #include "../include/new/battle_util.h"
 #include "../include/new/cmd49.h"
@@ -56,6 +57,8 @@ enum SpeedWarResults
 	SpeedTie,
 };
 
+#define SPEED_SNAPSHOT_EMPTY 0xFFFFFFFF //SpeedCalc never returns this
+
 extern void (* const sTurnActionsFuncsTable[])(void);
 extern void (* const sEndTurnFuncsTable[])(void);
 extern const u16 gClassBasedBattleBGM[];
@@ -86,6 +89,7 @@ static void SavePartyItems(void);
 static void TryPrepareTotemBoostInBattleSands(void);
 static void TrySetupRaidBossRepeatedAttack(u8 turnActionNumber);
 static u8 GetWhoStrikesFirstUseLastBracketCalc(u8 bank1, u8 bank2);
+static u32 GetTurnOrderSpeed(u8 bank);
 static u32 BoostSpeedInWeather(u8 ability, u8 itemEffect, u32 speed);
 static u32 BoostSpeedByItemEffect(u8 itemEffect, u8 itemQuality, u16 species, u32 speed, bool8 isDynamaxed);
 
@@ -106,6 +110,10 @@ void HandleNewBattleRamClearBeforeBattle(void)
 	}
 
 	FormsRevert(gPlayerParty); //Try to reset all forms before battle
+
+	#ifdef DEBUG_BATTLE_REPLAY
+	StartBattleReplay();
+	#endif
 }
 
 static void SavePartyItems(void)
@@ -135,6 +143,7 @@ void BattleBeginFirstTurn(void)
 					ResetBestMonToSwitchInto(i);
 				}
 
+				TakeSpeedSnapshot();
 				for (i = 0; i < gBattlersCount - 1; ++i)
 				{
 					for (j = i + 1; j < gBattlersCount; ++j)
@@ -143,6 +152,7 @@ void BattleBeginFirstTurn(void)
 							SwapTurnOrder(i, j);
 					}
 				}
+				ClearSpeedSnapshot();
 
 				//OW Weather
 				if (!gBattleStruct->overworldWeatherDone && AbilityBattleEffects(ABILITYEFFECT_ON_SWITCHIN, 0, 0, 0xFF, 0))
@@ -358,6 +368,7 @@ void BattleBeginFirstTurn(void)
 							gNewBS->ai.damageByMove[i][j][k] = 0xFFFFFFFF;
 							gNewBS->ai.moveKnocksOut1Hit[i][j][k] = 0xFF;
 							gNewBS->ai.moveKnocksOut2Hits[i][j][k] = 0xFF;
+							gNewBS->ai.maxRollDamageByMove[i][j][k] = 0xFFFFFFFF;
 						}
 					}
 				}
@@ -603,6 +614,7 @@ void SetActionsAndBanksTurnOrder(void)
 					++turnOrderId;
 				}
 			}
+			TakeSpeedSnapshot();
 			for (i = 0; i < gBattlersCount - 1; i++)
 			{
 				for (j = i + 1; j < gBattlersCount; j++)
@@ -619,6 +631,7 @@ void SetActionsAndBanksTurnOrder(void)
 					}
 				}
 			}
+			ClearSpeedSnapshot();
 		}
 	}
 
@@ -747,6 +760,7 @@ void RunTurnActionsFunctions(void)
 			return;
 
 		case Mega_CalcTurnOrder:
+			TakeSpeedSnapshot();
 			for (i = 0; i < gBattlersCount - 1; ++i)
 			{
 				for (j = i + 1; j < gBattlersCount; ++j)
@@ -765,6 +779,7 @@ void RunTurnActionsFunctions(void)
 					}
 				}
 			}
+			ClearSpeedSnapshot();
 			*megaBank = 0; //Reset the bank for the next loop
 			++gNewBS->megaData.state;
 			return;
@@ -903,6 +918,7 @@ void HandleAction_UseMove(void)
 	if (!gNewBS->PledgeHelper) //Don't recalculate during pledge execution
 	{
 		//Recalculate turn order before each attack
+		TakeSpeedSnapshot();
 		for (i = gCurrentTurnActionNumber; i < gBattlersCount - 1; ++i)
 		{
 			for (j = i + 1; j < gBattlersCount; ++j)
@@ -923,6 +939,7 @@ void HandleAction_UseMove(void)
 				}
 			}
 		}
+		ClearSpeedSnapshot();
 	}
 
 	gBankAttacker = gBanksByTurnOrder[gCurrentTurnActionNumber];
@@ -1073,8 +1090,8 @@ void HandleAction_UseMove(void)
 		if (IsRaidBattle() && gBankAttacker == BANK_RAID_BOSS)
 		{
 			u8 split = SPLIT(gCurrentMove);
-			bool8 isBannedMove = CheckTableForMove(gCurrentMove, gRaidBattleBannedRaidMonMoves)
-							  || CheckTableForMove(gCurrentMove, gRaidBattleBannedMoves)
+			bool8 isBannedMove = IsMoveInTable(gCurrentMove, gRaidBattleBannedRaidMonMoves)
+							  || IsMoveInTable(gCurrentMove, gRaidBattleBannedMoves)
 							  || IsUnusableMove(gCurrentMove, gBankAttacker, 0xFF, 1, ABILITY(gBankAttacker), ITEM_EFFECT(gBankAttacker), CHOICED_MOVE(gBankAttacker));
 
 			if (isBannedMove && split != SPLIT_STATUS) //Use banned status move - don't use Max Guard
@@ -1547,8 +1564,8 @@ u8 GetWhoStrikesFirst(u8 bank1, u8 bank2, bool8 ignoreMovePriorities)
 		return SecondMon;
 
 //SpeedCalc
-	bank1Spd = SpeedCalc(bank1);
-	bank2Spd = SpeedCalc(bank2);
+	bank1Spd = GetTurnOrderSpeed(bank1);
+	bank2Spd = GetTurnOrderSpeed(bank2);
 	u32 temp;
 	if (IsTrickRoomActive())
 	{
@@ -1588,8 +1605,8 @@ static u8 GetWhoStrikesFirstUseLastBracketCalc(u8 bank1, u8 bank2)
 		return SecondMon;
 
 	//SpeedCalc
-	bank1Spd = SpeedCalc(bank1);
-	bank2Spd = SpeedCalc(bank2);
+	bank1Spd = GetTurnOrderSpeed(bank1);
+	bank2Spd = GetTurnOrderSpeed(bank2);
 	u32 temp;
 	if (IsTrickRoomActive())
 	{
@@ -1876,3 +1893,31 @@ u32 SpeedCalcMon(u8 side, struct Pokemon* mon)
 
 	return speed;
 }
+
+//Nothing changes speeds while the turn order is being sorted, so from here until ClearSpeedSnapshot
+//each battler's speed is only calculated the first time a comparison needs it
+void TakeSpeedSnapshot(void)
+{
+	for (u32 i = 0; i < gBattlersCount; ++i)
+		gNewBS->speedSnapshot[i] = SPEED_SNAPSHOT_EMPTY;
+
+	gNewBS->speedSnapshotTaken = TRUE;
+}
+
+void ClearSpeedSnapshot(void)
+{
+	gNewBS->speedSnapshotTaken = FALSE;
+}
+
+static u32 GetTurnOrderSpeed(u8 bank)
+{
+	if (gNewBS->speedSnapshotTaken)
+	{
+		if (gNewBS->speedSnapshot[bank] == SPEED_SNAPSHOT_EMPTY)
+			gNewBS->speedSnapshot[bank] = SpeedCalc(bank);
+
+		return gNewBS->speedSnapshot[bank];
+	}
+
+	return SpeedCalc(bank);
+}
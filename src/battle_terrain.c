@@ -37,7 +37,7 @@ u8 BattleSetup_GetTerrainId(void)
 	u8 terrain = BATTLE_TERRAIN_PLAIN;
 
 	PlayerGetDestCoords(&x, &y);
-	tileBehavior = MapGridGetMetatileBehaviorAt(x, y);
+	tileBehavior = GetCachedMetatileBehaviorAt(x, y);
 
 	#ifdef VAR_BATTLE_BG
 	if (VarGet(VAR_BATTLE_BG))
@@ -269,7 +269,7 @@ static u8 TryLoadAlternateAreaTerrain(u8 terrain)
 	s16 x, y;
 
 	PlayerGetDestCoords(&x, &y);
-	tileBehavior = MapGridGetMetatileBehaviorAt(x, y);
+	tileBehavior = GetCachedMetatileBehaviorAt(x, y);
 
 	if (TestPlayerAvatarFlags(PLAYER_AVATAR_FLAG_SURFING))
 	{
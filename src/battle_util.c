@@ -153,8 +153,13 @@ void ClearBattlerAbilityHistory(u8 bank)
 
 item_effect_t GetBankItemEffect(u8 bank)
 {
-	if (ABILITY(bank) != ABILITY_KLUTZ && !gNewBS->EmbargoTimers[bank] && !IsMagicRoomActive())
-		return ItemId_GetHoldEffect(ITEM(bank));
+	u16 item = ITEM(bank);
+
+	if (item != ITEM_NONE //Can't have an effect if you have no item
+	&& !gNewBS->EmbargoTimers[bank]
+	&& !IsMagicRoomActive()
+	&& ABILITY(bank) != ABILITY_KLUTZ)
+		return ItemId_GetHoldEffect(item);
 
 	return 0;
 }
@@ -249,20 +254,25 @@ bool8 CanHitSemiInvulnerableTarget(u8 bankAtk, u8 bankDef, u16 move)
 
 bool8 CheckGrounding(u8 bank)
 {
-	if (BATTLER_SEMI_INVULNERABLE(bank)) //Apparently a thing
+	u32 status3 = gStatuses3[bank];
+
+	if (status3 & STATUS3_SEMI_INVULNERABLE) //Apparently a thing
 		return IN_AIR;
 
 	if (IsGravityActive()
-	|| GetBankItemEffect(bank) == ITEM_EFFECT_IRON_BALL
-	|| (gStatuses3[bank] & (STATUS3_SMACKED_DOWN | STATUS3_ROOTED)))
+	|| (status3 & (STATUS3_SMACKED_DOWN | STATUS3_ROOTED)))
 		return GROUNDED;
 
-	else if ((gStatuses3[bank] & (STATUS3_LEVITATING | STATUS3_TELEKINESIS | STATUS3_IN_AIR))
-		   || ITEM_EFFECT(bank) == ITEM_EFFECT_AIR_BALLOON
-		   || ABILITY(bank) == ABILITY_LEVITATE
+	u8 itemEffect = ITEM_EFFECT(bank); //Only worked out once since it's needed for both the Iron Ball and Air Balloon
+	if (itemEffect == ITEM_EFFECT_IRON_BALL)
+		return GROUNDED;
+
+	else if ((status3 & (STATUS3_LEVITATING | STATUS3_TELEKINESIS | STATUS3_IN_AIR))
+		   || itemEffect == ITEM_EFFECT_AIR_BALLOON
 		   || gBattleMons[bank].type3 == TYPE_FLYING
 		   || gBattleMons[bank].type1 == TYPE_FLYING
-		   || gBattleMons[bank].type2 == TYPE_FLYING)
+		   || gBattleMons[bank].type2 == TYPE_FLYING
+		   || ABILITY(bank) == ABILITY_LEVITATE)
 				return IN_AIR;
 
 	return GROUNDED;
@@ -354,12 +364,12 @@ bool8 CheckHealingMove(move_t move)
 
 bool8 CheckSoundMove(move_t move)
 {
-	return CheckTableForMove(move, gSoundMoves);
+	return IsMoveInTable(move, gSoundMoves);
 }
 
 bool8 SheerForceCheck(void)
 {
-	return ABILITY(gBankAttacker) == ABILITY_SHEERFORCE && CheckTableForMove(gCurrentMove, gSheerForceBoostedMoves);
+	return ABILITY(gBankAttacker) == ABILITY_SHEERFORCE && IsMoveInTable(gCurrentMove, gSheerForceBoostedMoves);
 }
 
 bool8 IsOfType(u8 bank, u8 type)
@@ -500,73 +510,136 @@ u8 CountBoosts(u8 bank)
 	return sum;
 }
 
-u8 CheckMoveLimitations(u8 bank, u8 unusableMoves, u8 check)
-{
-	u8 ability = ABILITY(bank);
-	u8 holdEffect = ITEM_EFFECT(bank);
-	u16 choicedMove = CHOICED_MOVE(bank);
-	int i;
-
-	gStringBank = bank;
-	for (i = 0; i < MAX_MON_MOVES; ++i)
-	{
-		u16 move = gBattleMons[bank].moves[i];
-		if (IsDynamaxed(bank))
-			move = GetMaxMoveByMove(bank, move);
-
-		if (IsUnusableMove(move, bank, check, gBattleMons[bank].pp[i], ability, holdEffect, choicedMove))
-			unusableMoves |= gBitTable[i];
-	}
+//Limitations that depend only on the battler or the field, not on the move being checked
+enum
+{
+	ACTIVE_LIMITATION_DISABLED    = 1 << 0,
+	ACTIVE_LIMITATION_TORMENTED   = 1 << 1,
+	ACTIVE_LIMITATION_TAUNT       = 1 << 2,
+	ACTIVE_LIMITATION_IMPRISION   = 1 << 3,
+	ACTIVE_LIMITATION_ENCORE      = 1 << 4,
+	ACTIVE_LIMITATION_CHOICE      = 1 << 5,
+	ACTIVE_LIMITATION_ASSAULT_VEST = 1 << 6,
+	ACTIVE_LIMITATION_SKY_BATTLE  = 1 << 7,
+	ACTIVE_LIMITATION_GRAVITY     = 1 << 8,
+	ACTIVE_LIMITATION_THROAT_CHOP = 1 << 9,
+	ACTIVE_LIMITATION_HEAL_BLOCK  = 1 << 10,
+	ACTIVE_LIMITATION_RAID_BAN    = 1 << 11,
+};
+
+static u16 GetActiveMoveLimitations(u8 bank, u8 check, u8 ability, u8 holdEffect, u16 choicedMove)
+{
+	u16 active = 0;
+
+	if (check & MOVE_LIMITATION_DISABLED)
+		active |= ACTIVE_LIMITATION_DISABLED;
+	if (check & MOVE_LIMITATION_TORMENTED && IsTormented(bank))
+		active |= ACTIVE_LIMITATION_TORMENTED;
+	if (check & MOVE_LIMITATION_TAUNT && IsTaunted(bank))
+		active |= ACTIVE_LIMITATION_TAUNT;
+	if (check & MOVE_LIMITATION_IMPRISION)
+		active |= ACTIVE_LIMITATION_IMPRISION;
+	if (gDisableStructs[bank].encoreTimer && check & MOVE_LIMITATION_ENCORE)
+		active |= ACTIVE_LIMITATION_ENCORE;
+	if ((holdEffect == ITEM_EFFECT_CHOICE_BAND || ability == ABILITY_GORILLATACTICS)
+	&& choicedMove != 0 && choicedMove != 0xFFFF
+	&& check & MOVE_LIMITATION_CHOICE)
+		active |= ACTIVE_LIMITATION_CHOICE;
+	if (holdEffect == ITEM_EFFECT_ASSAULT_VEST)
+		active |= ACTIVE_LIMITATION_ASSAULT_VEST;
+	#ifdef FLAG_SKY_BATTLE
+	if (FlagGet(FLAG_SKY_BATTLE))
+		active |= ACTIVE_LIMITATION_SKY_BATTLE;
+	#endif
+	if (IsGravityActive())
+		active |= ACTIVE_LIMITATION_GRAVITY;
+	if (CantUseSoundMoves(bank))
+		active |= ACTIVE_LIMITATION_THROAT_CHOP;
+	if (IsHealBlocked(bank))
+		active |= ACTIVE_LIMITATION_HEAL_BLOCK;
+	if (IsRaidBattle() && bank != BANK_RAID_BOSS)
+		active |= ACTIVE_LIMITATION_RAID_BAN;
 
-	return unusableMoves;
+	return active;
 }
 
-bool8 IsUnusableMove(u16 move, u8 bank, u8 check, u8 pp, u8 ability, u8 holdEffect, u16 choicedMove)
+static bool8 IsMoveLimited(u16 move, u8 bank, u8 check, u8 pp, u16 active, u16 choicedMove)
 {
-	bool8 isMaxMove = IsAnyMaxMove(move);
+	bool8 isMaxMove;
 
 	if (move == MOVE_NONE && check & MOVE_LIMITATION_ZEROMOVE)
 		return TRUE;
 	else if (pp == 0 && check & MOVE_LIMITATION_PP)
 		return TRUE;
-	else if (!isMaxMove && move == gDisableStructs[bank].disabledMove && check & MOVE_LIMITATION_DISABLED)
+	else if (active == 0) //Nothing else can stop the move
+		return FALSE;
+
+	isMaxMove = IsAnyMaxMove(move);
+
+	if (!isMaxMove && active & ACTIVE_LIMITATION_DISABLED && move == gDisableStructs[bank].disabledMove)
 		return TRUE;
-	else if (!isMaxMove && move == gLastUsedMoves[bank] && check & MOVE_LIMITATION_TORMENTED && IsTormented(bank))
+	else if (!isMaxMove && active & ACTIVE_LIMITATION_TORMENTED && move == gLastUsedMoves[bank])
 		return TRUE;
-	else if (IsTaunted(bank) && check & MOVE_LIMITATION_TAUNT && SPLIT(move) == SPLIT_STATUS)
+	else if (active & ACTIVE_LIMITATION_TAUNT && SPLIT(move) == SPLIT_STATUS)
 		return TRUE;
-	else if (!isMaxMove && IsImprisoned(bank, move) && check & MOVE_LIMITATION_IMPRISION)
+	else if (!isMaxMove && active & ACTIVE_LIMITATION_IMPRISION && IsImprisoned(bank, move))
 		return TRUE;
-	else if (gDisableStructs[bank].encoreTimer && gDisableStructs[bank].encoredMove != move && check & MOVE_LIMITATION_ENCORE)
+	else if (active & ACTIVE_LIMITATION_ENCORE && gDisableStructs[bank].encoredMove != move)
 		return TRUE;
-	else if (!isMaxMove
-		 && (holdEffect == ITEM_EFFECT_CHOICE_BAND || ability == ABILITY_GORILLATACTICS)
-		 && choicedMove != 0 && choicedMove != 0xFFFF && choicedMove != move
-		 && check & MOVE_LIMITATION_CHOICE)
-	{
+	else if (!isMaxMove && active & ACTIVE_LIMITATION_CHOICE && choicedMove != move)
 		return TRUE;
-	}
-	else if (holdEffect == ITEM_EFFECT_ASSAULT_VEST && SPLIT(move) == SPLIT_STATUS)
+	else if (active & ACTIVE_LIMITATION_ASSAULT_VEST && SPLIT(move) == SPLIT_STATUS)
 		return TRUE;
 	#ifdef FLAG_SKY_BATTLE
-	else if (FlagGet(FLAG_SKY_BATTLE) && CheckTableForMove(move, gSkyBattleBannedMoves))
+	else if (active & ACTIVE_LIMITATION_SKY_BATTLE && IsMoveInTable(move, gSkyBattleBannedMoves))
 		return TRUE;
 	#endif
-	else if (IsGravityActive() && CheckTableForMove(move, gGravityBannedMoves))
+	else if (active & ACTIVE_LIMITATION_GRAVITY && IsMoveInTable(move, gGravityBannedMoves))
 		return TRUE;
-	else if (CantUseSoundMoves(bank) && CheckSoundMove(move))
+	else if (active & ACTIVE_LIMITATION_THROAT_CHOP && CheckSoundMove(move))
 		return TRUE;
-	else if (IsHealBlocked(bank) && CheckHealingMove(move))
+	else if (active & ACTIVE_LIMITATION_HEAL_BLOCK && CheckHealingMove(move))
 		return TRUE;
-	else if (IsRaidBattle() && bank != BANK_RAID_BOSS && CheckTableForMove(move, gRaidBattleBannedMoves))
+	else if (active & ACTIVE_LIMITATION_RAID_BAN && IsMoveInTable(move, gRaidBattleBannedMoves))
 		return TRUE;
 
 	return FALSE;
 }
 
+u8 CheckMoveLimitations(u8 bank, u8 unusableMoves, u8 check)
+{
+	u16 choicedMove = CHOICED_MOVE(bank);
+	u16 active = GetActiveMoveLimitations(bank, check, ABILITY(bank), ITEM_EFFECT(bank), choicedMove); //Worked out once for all four moves
+	bool8 isDynamaxed = IsDynamaxed(bank);
+	int i;
+
+	gStringBank = bank;
+	for (i = 0; i < MAX_MON_MOVES; ++i)
+	{
+		u16 move = gBattleMons[bank].moves[i];
+		if (isDynamaxed)
+			move = GetMaxMoveByMove(bank, move);
+
+		if (IsMoveLimited(move, bank, check, gBattleMons[bank].pp[i], active, choicedMove))
+			unusableMoves |= gBitTable[i];
+	}
+
+	return unusableMoves;
+}
+
+bool8 IsUnusableMove(u16 move, u8 bank, u8 check, u8 pp, u8 ability, u8 holdEffect, u16 choicedMove)
+{
+	return IsMoveLimited(move, bank, check, pp, GetActiveMoveLimitations(bank, check, ability, holdEffect, choicedMove), choicedMove);
+}
+
 u8 CheckMoveLimitationsFromParty(struct Pokemon* mon, u8 unusableMoves, u8 check)
 {
 	u8 holdEffect = GetMonItemEffect(mon);
+	bool8 gravityActive = IsGravityActive();
+	bool8 raidBattle = IsRaidBattle();
+	#ifdef FLAG_SKY_BATTLE
+	bool8 skyBattle = FlagGet(FLAG_SKY_BATTLE);
+	#endif
 
 	for (int i = 0; i < MAX_MON_MOVES; ++i)
 	{
@@ -574,17 +647,17 @@ u8 CheckMoveLimitationsFromParty(struct Pokemon* mon, u8 unusableMoves, u8 check
 
 		if (move == MOVE_NONE && check & MOVE_LIMITATION_ZEROMOVE)
 			unusableMoves |= gBitTable[i];
-		else if (GetMonData(mon, MON_DATA_PP1 + i, NULL) == 0 && check & MOVE_LIMITATION_PP)
+		else if (check & MOVE_LIMITATION_PP && GetMonData(mon, MON_DATA_PP1 + i, NULL) == 0)
 			unusableMoves |= gBitTable[i];
 		else if (holdEffect == ITEM_EFFECT_ASSAULT_VEST && SPLIT(move) == SPLIT_STATUS)
 			unusableMoves |= gBitTable[i];
 		#ifdef FLAG_SKY_BATTLE
-		else if (FlagGet(FLAG_SKY_BATTLE) && CheckTableForMove(move, gSkyBattleBannedMoves))
+		else if (skyBattle && IsMoveInTable(move, gSkyBattleBannedMoves))
 			unusableMoves |= gBitTable[i];
 		#endif
-		else if (IsGravityActive() && CheckTableForMove(move, gGravityBannedMoves))
+		else if (gravityActive && IsMoveInTable(move, gGravityBannedMoves))
 			unusableMoves |= gBitTable[i];
-		else if (IsRaidBattle() && CheckTableForMove(move, gRaidBattleBannedMoves))
+		else if (raidBattle && IsMoveInTable(move, gRaidBattleBannedMoves))
 			unusableMoves |= gBitTable[i];
 	}
 
@@ -1111,7 +1184,7 @@ bool8 MoveIgnoresSubstitutes(u16 move, u8 atkAbility)
 {
 	return CheckSoundMove(move)
 		|| (atkAbility == ABILITY_INFILTRATOR && move != MOVE_TRANSFORM && move != MOVE_SKYDROP)
-		|| CheckTableForMove(move, gSubstituteBypassMoves);
+		|| IsMoveInTable(move, gSubstituteBypassMoves);
 }
 
 bool8 MoveBlockedBySubstitute(u16 move, u8 bankAtk, u8 bankDef)
@@ -1133,7 +1206,7 @@ bool8 IsMoveAffectedByParentalBond(u16 move, u8 bankAtk)
 {
 	if (SPLIT(move) != SPLIT_STATUS
 	&& !IsAnyMaxMove(move)
-	&& !CheckTableForMove(move, gParentalBondBannedMoves)
+	&& !IsMoveInTable(move, gParentalBondBannedMoves)
 	&& !IsTwoTurnsMove(move)
 	&& gBattleMoves[move].effect != EFFECT_0HKO
 	&& gBattleMoves[move].effect != EFFECT_MULTI_HIT
@@ -1162,7 +1235,7 @@ bool8 IsMoveAffectedByParentalBond(u16 move, u8 bankAtk)
 
 u8 CalcMoveSplit(u8 bank, u16 move)
 {
-	if (CheckTableForMove(move, gMovesThatChangePhysicality)
+	if (IsMoveInTable(move, gMovesThatChangePhysicality)
 	&&  SPLIT(move) != SPLIT_STATUS)
 	{
 		u32 attack = gBattleMons[bank].attack;
@@ -1192,7 +1265,7 @@ u8 CalcMoveSplit(u8 bank, u16 move)
 
 u8 CalcMoveSplitFromParty(struct Pokemon* mon, u16 move)
 {
-	if (CheckTableForMove(move, gMovesThatChangePhysicality))
+	if (IsMoveInTable(move, gMovesThatChangePhysicality))
 	{
 		if (mon->spAttack >= mon->attack)
 			return SPLIT_SPECIAL;
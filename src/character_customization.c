@@ -146,6 +146,11 @@ NPCPtr GetEventObjectGraphicsInfo(u16 graphicsId)
 			case EVENT_OBJ_GFX_RED_BIKE_VS_SEEKER:
 			case EVENT_OBJ_GFX_LEAF_BIKE_VS_SEEKER:
 				newId = VarGet(VAR_PLAYER_VS_SEEKER_ON_BIKE);
+				if (newId != 0) //Custom VS Seeker on bike sprite
+				{
+					tableId = (newId >> 8) & 0xFF;	// upper byte
+					spriteId = (newId & 0xFF);		// lower byte
+				}
 				break;
 		}
 
@@ -737,7 +737,7 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 			&&  gBankAttacker != bankDef
 			&&  MOVE_HAD_EFFECT
 			&&  TOOK_DAMAGE(bankDef)
-			&& (moveType == TYPE_FIRE || CheckTableForMove(gCurrentMove, gMovesCanUnfreezeTarget)))
+			&& (moveType == TYPE_FIRE || IsMoveInTable(gCurrentMove, gMovesCanUnfreezeTarget)))
 			{
 				gBattleMons[bankDef].status1 &= ~(STATUS1_FREEZE);
 				gActiveBattler = bankDef;
@@ -976,7 +976,7 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 							}
 						}
 					}
-					else if (gBattleMoves[gCurrentMove].target == MOVE_TARGET_ALL && !CheckTableForMove(gCurrentMove, gSpecialWholeFieldMoves))
+					else if (gBattleMoves[gCurrentMove].target == MOVE_TARGET_ALL && !IsMoveInTable(gCurrentMove, gSpecialWholeFieldMoves))
 					{
 						if (gNewBS->OriginalAttackerTargetCount < 3)
 						{ //Get Next Target
@@ -1055,42 +1055,42 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 				&& gNewBS->AttackerDidDamageAtLeastOnce
 				&& BATTLER_ALIVE(gBankAttacker))
 				{
-					if (CheckTableForMove(gCurrentMove, gPercent25RecoilMoves))
+					if (IsMoveInTable(gCurrentMove, gPercent25RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, gNewBS->totalDamageGiven / 4);
 						BattleScriptPushCursor();
 						gBattlescriptCurrInstr = BattleScript_Recoil;
 						effect = 1;
 					}
-					else if (CheckTableForMove(gCurrentMove, gPercent33RecoilMoves))
+					else if (IsMoveInTable(gCurrentMove, gPercent33RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, gNewBS->totalDamageGiven / 3);
 						BattleScriptPushCursor();
 						gBattlescriptCurrInstr = BattleScript_Recoil;
 						effect = 1;
 					}
-					else if (CheckTableForMove(gCurrentMove, gPercent50RecoilMoves))
+					else if (IsMoveInTable(gCurrentMove, gPercent50RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, gNewBS->totalDamageGiven / 2);
 						BattleScriptPushCursor();
 						gBattlescriptCurrInstr = BattleScript_Recoil;
 						effect = 1;
 					}
-					else if (CheckTableForMove(gCurrentMove, gPercent66RecoilMoves))
+					else if (IsMoveInTable(gCurrentMove, gPercent66RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, (gNewBS->totalDamageGiven * 2) / 3);
 						BattleScriptPushCursor();
 						gBattlescriptCurrInstr = BattleScript_Recoil;
 						effect = 1;
 					}
-					else if (CheckTableForMove(gCurrentMove, gPercent75RecoilMoves))
+					else if (IsMoveInTable(gCurrentMove, gPercent75RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, (gNewBS->totalDamageGiven * 3) / 4);
 						BattleScriptPushCursor();
 						gBattlescriptCurrInstr = BattleScript_Recoil;
 						effect = 1;
 					}
-					else if (CheckTableForMove(gCurrentMove, gPercent100RecoilMoves))
+					else if (IsMoveInTable(gCurrentMove, gPercent100RecoilMoves))
 					{
 						gBattleMoveDamage = MathMax(1, gNewBS->totalDamageGiven);
 						BattleScriptPushCursor();
@@ -1392,7 +1392,7 @@ void atk49_moveend(void) //All the effects that happen after a move is used
 			&& ABILITY_PRESENT(ABILITY_DANCER)
 			&& gNewBS->attackAnimationPlayed
 			&& !gNewBS->moveWasBouncedThisTurn
-			&& CheckTableForMove(gCurrentMove, gDanceMoves))
+			&& IsMoveInTable(gCurrentMove, gDanceMoves))
 			{
 				gNewBS->DancerInProgress = TRUE;
 				gNewBS->CurrentTurnAttacker = gBankAttacker;
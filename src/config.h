@@ -10,6 +10,9 @@
 //#define DEBUG_HMS //HMs can always be used from the party screen, Surf, Waterfall, and Rock Climb can always be used
 //#define DEBUG_OBEDIENCE //Traded Pokemon never have obedience issues
 //#define DEBUG_DYNAMAX //Dynamax can be used in Dynamax battles without a Dynamax Band
+//#define DEBUG_BATTLE_REPLAY //The seed and inputs of each battle are recorded at 0x203EE10 and can be played back by setting the mode to BATTLE_REPLAY_PLAY_NEXT_BATTLE. Holds 311 key changes (~150 button presses); longer battles stop recording and set the overflowed flag
+//#define DEBUG_MAP_SCRIPT_PROFILING //The most expensive map script runs are kept at 0x203F300 along with the map they were on
+//#define DEBUG_AI_TRACE //The AI records its move scores, switching scores, choices, and thinking time to a ring buffer at 0x203EB08
 
 /*===== General Vars =====*/
 #define VAR_TERRAIN 0x5000 //Set to a terrain type for a battle to begin with the given terrain
@@ -143,6 +146,7 @@ enum //These vars need to be one after the other (hence the enum)
 #define CREATE_ROAMER_WITH_X_PERFECT_IVS 3 //Change this to the number of set 31 IVs you'd like roaming pokemon to have.
 #define EGG_HATCH_LEVEL 1 //The level eggs hatch at
 #define AI_TRY_TO_KILL_RATE 50 //In battles against a trainer with AI flags of 1, the AI will try to use a move to knock out the opponents XX percent of the time
+#define AI_KO_CHANCE_THRESHOLD 50 //The AI treats a move as able to knock out the foe if at least XX percent of its damage rolls would. 50 matches the old fixed 93% roll for single hits
 
 /*===== Metatile Behaviours =====*/
 #define MB_OMNIDIRECTIONAL_JUMP 0x7F //The tile behaviour byte that can be jumped over in all directions
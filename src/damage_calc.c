@@ -57,6 +57,7 @@ static void TypeDamageModificationByDefTypes(u8 atkAbility, u8 bankDef, u16 move
 static void ModulateDmgByType(u8 multiplier, const u16 move, const u8 moveType, const u8 defType, const u8 bankDef, u8 atkAbility, u8* flags, struct Pokemon* monDef, bool8 checkMonDef);
 static bool8 AbilityCanChangeTypeAndBoost(u16 move, u8 atkAbility, u8 electrifyTimer, bool8 checkIonDeluge, bool8 zMoveActive);
 static s32 CalculateBaseDamage(struct DamageCalc* data);
+static void ApplyMoveIndependentDefenderModifiers(struct DamageCalc* data);
 static u16 GetBasePower(struct DamageCalc* data);
 static u16 AdjustBasePower(struct DamageCalc* data, u16 power);
 static u16 GetZMovePower(u16 zMove);
@@ -103,14 +104,14 @@ void atk04_critcalc(void)
 		}
 		else if ((atkAbility == ABILITY_MERCILESS && (gBattleMons[bankDef].status1 & STATUS_PSN_ANY))
 		|| IsLaserFocused(gBankAttacker)
-		|| CheckTableForMove(gCurrentMove, gAlwaysCriticalMoves))
+		|| IsMoveInTable(gCurrentMove, gAlwaysCriticalMoves))
 		{
 			confirmedCrit = TRUE;
 		}
 		else 
 		{
 			critChance  = 2 * ((gBattleMons[gBankAttacker].status2 & STATUS2_FOCUS_ENERGY) != 0)
-						+ (CheckTableForMove(gCurrentMove, gHighCriticalChanceMoves))
+						+ (IsMoveInTable(gCurrentMove, gHighCriticalChanceMoves))
 						+ (atkEffect == ITEM_EFFECT_SCOPE_LENS)
 						+ (atkAbility == ABILITY_SUPERLUCK)
 						#ifdef SPECIES_CHANSEY
@@ -190,12 +191,12 @@ static u8 CalcPossibleCritChance(u8 bankAtk, u8 bankDef, u16 move, struct Pokemo
 
 	else if ((atkAbility == ABILITY_MERCILESS && (defStatus1 & STATUS_PSN_ANY))
 	|| (IsLaserFocused(bankAtk) && monAtk == NULL)
-	|| CheckTableForMove(move, gAlwaysCriticalMoves))
+	|| IsMoveInTable(move, gAlwaysCriticalMoves))
 		return TRUE;
 
 	else {
 		critChance  = 2 * ((atkStatus2 & STATUS2_FOCUS_ENERGY) != 0)
-					+ (CheckTableForMove(move, gHighCriticalChanceMoves))
+					+ (IsMoveInTable(move, gHighCriticalChanceMoves))
 					+ (atkEffect == ITEM_EFFECT_SCOPE_LENS)
 					+ (atkAbility == ABILITY_SUPERLUCK)
 					#ifdef SPECIES_CHANSEY
@@ -289,6 +290,30 @@ s32 ConfusionDamageCalc(void)
 	return gBattleMoveDamage;
 }
 
+//Scales the damage of a single hit by the number of times the AI expects the move to hit.
+//Returns FALSE if the move only hits once.
+bool8 AI_AdjustDamageForMultiHits(u32* damage, u16 move, u8 bankAtk, u8 atkAbility)
+{
+	if (IsMoveInTable(move, gTwoToFiveStrikesMoves) && atkAbility == ABILITY_SKILLLINK)
+		*damage *= 5;
+	else if (IsMoveInTable(move, gTwoToFiveStrikesMoves) || IsMoveInTable(move, gThreeStrikesMoves)) //Three hits on average
+		*damage *= 3;
+	else if (IsMoveInTable(move, gTwoStrikesMoves))
+		*damage *= 2;
+	else if (atkAbility == ABILITY_PARENTALBOND && IsMoveAffectedByParentalBond(move, bankAtk))
+	{
+		#ifdef OLD_PARENTAL_BOND_DAMAGE
+			*damage = (*damage * 150) / 100; //1.5x overall boost
+		#else
+			*damage = (*damage * 125) / 100; //1.25x overall boost
+		#endif
+	}
+	else
+		return FALSE;
+
+	return TRUE;
+}
+
 u32 AI_CalcDmg(const u8 bankAtk, const u8 bankDef, const u16 move, struct DamageCalc* damageData)
 {
 	u8 resultFlags = AI_SpecialTypeCalc(move, bankAtk, bankDef);
@@ -350,34 +375,12 @@ u32 AI_CalcDmg(const u8 bankAtk, const u8 bankDef, const u16 move, struct Damage
 	damage = (gBattleMoveDamage * gCritMultiplier) / BASE_CRIT_MULTIPLIER;
 	gCritMultiplier = BASE_CRIT_MULTIPLIER; //Reset
 
+	damageData->maxRollDamage = damage;
 	damage = (damage * 93) / 100; //Roll 93% damage - about halfway between min & max damage
 
-	if (CheckTableForMove(move, gTwoToFiveStrikesMoves) && ABILITY(bankAtk) == ABILITY_SKILLLINK)
-	{
-		damage *= 5;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoToFiveStrikesMoves) || CheckTableForMove(move, gThreeStrikesMoves)) //Three hits on average
-	{
-		damage *= 3;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoStrikesMoves))
-	{
-		damage *= 2;
-		return damage;
-	}
-	else if (ABILITY(bankAtk) == ABILITY_PARENTALBOND && IsMoveAffectedByParentalBond(move, bankAtk))
-	{
-		#ifdef OLD_PARENTAL_BOND_DAMAGE
-			damage = (damage * 150) / 100; //1.5x overall boost
-		#else
-			damage = (damage * 125) / 100; //1.25x overall boost
-		#endif
-		return damage;
-	}
+	if (AI_AdjustDamageForMultiHits(&damage, move, bankAtk, ABILITY(bankAtk)))
+		return damage; //Multi hit moves skip these checks
 
-	//Multi hit moves skip these checks
 	if (gBattleMoves[move].effect == EFFECT_FALSE_SWIPE
 	|| (BATTLER_MAX_HP(bankDef) && ABILITY(bankDef) == ABILITY_STURDY && NO_MOLD_BREAKERS(ABILITY(bankAtk), move))
 	|| (BATTLER_MAX_HP(bankDef) && IsBankHoldingFocusSash(bankDef)))
@@ -446,34 +449,12 @@ u32 AI_CalcPartyDmg(u8 bankAtk, u8 bankDef, u16 move, struct Pokemon* monAtk, st
 	damage = (gBattleMoveDamage * gCritMultiplier) / BASE_CRIT_MULTIPLIER;
 	gCritMultiplier = BASE_CRIT_MULTIPLIER; //Reset
 
+	damageData->maxRollDamage = damage;
 	damage = (damage * 96) / 100; //Roll 96% damage with party mons - be more idealistic
 
-	if (CheckTableForMove(move, gTwoToFiveStrikesMoves) && GetMonAbility(monAtk) == ABILITY_SKILLLINK)
-	{
-		damage *= 5;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoToFiveStrikesMoves) || CheckTableForMove(move, gThreeStrikesMoves)) //Three hits on average
-	{
-		damage *= 3;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoStrikesMoves))
-	{
-		damage *= 2;
-		return damage;
-	}
-	else if (GetMonAbility(monAtk) == ABILITY_PARENTALBOND && IsMoveAffectedByParentalBond(move, bankAtk))
-	{
-		#ifdef OLD_PARENTAL_BOND_DAMAGE
-			damage = (damage * 150) / 100; //1.5x overall boost
-		#else
-			damage = (damage * 125) / 100; //1.25x overall boost
-		#endif
-		return damage;
-	}
+	if (AI_AdjustDamageForMultiHits(&damage, move, bankAtk, GetMonAbility(monAtk)))
+		return damage; //Multi hit moves skip these checks
 
-	//Multi hit moves skip these checks
 	if (gBattleMoves[move].effect == EFFECT_FALSE_SWIPE
 	|| (BATTLER_MAX_HP(bankDef) && ABILITY(bankDef) == ABILITY_STURDY && NO_MOLD_BREAKERS(GetMonAbility(monAtk), move))
 	|| (BATTLER_MAX_HP(bankDef) && IsBankHoldingFocusSash(bankDef)))
@@ -539,34 +520,12 @@ u32 AI_CalcMonDefDmg(u8 bankAtk, u8 bankDef, u16 move, struct Pokemon* monDef, s
 	damage = (gBattleMoveDamage * gCritMultiplier) / BASE_CRIT_MULTIPLIER;
 	gCritMultiplier = BASE_CRIT_MULTIPLIER; //Reset
 
+	damageData->maxRollDamage = damage;
 	damage = (damage * 96) / 100; //Roll 96% damage with party mons - be more idealistic
 
-	if (CheckTableForMove(move, gTwoToFiveStrikesMoves) && ABILITY(bankAtk) == ABILITY_SKILLLINK)
-	{
-		damage *= 5;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoToFiveStrikesMoves) || CheckTableForMove(move, gThreeStrikesMoves)) //Three hits on average
-	{
-		damage *= 3;
-		return damage;
-	}
-	else if (CheckTableForMove(move, gTwoStrikesMoves))
-	{
-		damage *= 2;
-		return damage;
-	}
-	else if (ABILITY(bankAtk) == ABILITY_PARENTALBOND && IsMoveAffectedByParentalBond(move, bankAtk))
-	{
-		#ifdef OLD_PARENTAL_BOND_DAMAGE
-			damage = (damage * 150) / 100; //1.5x overall boost
-		#else
-			damage = (damage * 125) / 100; //1.25x overall boost
-		#endif
-		return damage;
-	}
+	if (AI_AdjustDamageForMultiHits(&damage, move, bankAtk, ABILITY(bankAtk)))
+		return damage; //Multi hit moves skip these checks
 
-	//Multi hit moves skip these checks
 	if (gBattleMoves[move].effect == EFFECT_FALSE_SWIPE
 	|| (monDef->hp == monDef->maxHP && GetMonAbility(monDef) == ABILITY_STURDY && NO_MOLD_BREAKERS(ABILITY(bankAtk), move))
 	|| (monDef->hp == monDef->maxHP && IsBankHoldingFocusSash(bankDef)))
@@ -644,7 +603,7 @@ void atk06_typecalc(void)
 			}
 
 			//Check Powder Moves
-			else if (CheckTableForMove(gCurrentMove, gPowderMoves))
+			else if (IsMoveInTable(gCurrentMove, gPowderMoves))
 			{
 				if (defAbility == ABILITY_OVERCOAT)
 				{
@@ -746,7 +705,7 @@ void atk4A_typecalc2(void)
 		else
 			goto RE_ENTER_TYPE_CHECK_2;	//You're a flying type
 	}
-	else if (CheckTableForMove(gCurrentMove, gPowderMoves))
+	else if (IsMoveInTable(gCurrentMove, gPowderMoves))
 	{
 		if (defAbility == ABILITY_OVERCOAT)
 		{
@@ -849,7 +808,7 @@ u8 TypeCalc(u16 move, u8 bankAtk, u8 bankDef, struct Pokemon* monAtk, bool8 Chec
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
-	else if (CheckTableForMove(move, gPowderMoves) && !IsAffectedByPowder(bankDef))
+	else if (IsMoveInTable(move, gPowderMoves) && !IsAffectedByPowder(bankDef))
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
@@ -915,7 +874,7 @@ u8 AI_TypeCalc(u16 move, u8 bankAtk, struct Pokemon* monDef) {
 	{
 		flags = MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE;
 	}
-	else if (CheckTableForMove(move, gPowderMoves)
+	else if (IsMoveInTable(move, gPowderMoves)
 	&& (defAbility == ABILITY_OVERCOAT || defEffect == ITEM_EFFECT_SAFETY_GOGGLES || defType1 == TYPE_GRASS || defType2 == TYPE_GRASS))
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
@@ -992,7 +951,7 @@ u8 AI_SpecialTypeCalc(u16 move, u8 bankAtk, u8 bankDef)
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
-	else if (CheckTableForMove(move, gPowderMoves) && !IsAffectedByPowderByDetails(defType1, defType2, defType3, defAbility, defEffect))
+	else if (IsMoveInTable(move, gPowderMoves) && !IsAffectedByPowderByDetails(defType1, defType2, defType3, defAbility, defEffect))
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
@@ -1058,7 +1017,7 @@ u8 VisualTypeCalc(u16 move, u8 bankAtk, u8 bankDef)
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
-	else if (CheckTableForMove(move, gPowderMoves) && !IsAffectedByPowderByDetails(defType1, defType2, defType3, defAbility, defEffect))
+	else if (IsMoveInTable(move, gPowderMoves) && !IsAffectedByPowderByDetails(defType1, defType2, defType3, defAbility, defEffect))
 	{
 		flags |= (MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE);
 	}
@@ -1248,7 +1207,7 @@ u8 GetMoveTypeSpecialPreAbility(u16 move, u8 bankAtk, struct Pokemon* monAtk)
 	if (monAtk == NULL && gNewBS->ElectrifyTimers[bankAtk] > 0)
 		return TYPE_ELECTRIC;
 
-	if (CheckTableForMove(move, gTypeChangeExceptionMoves))
+	if (IsMoveInTable(move, gTypeChangeExceptionMoves))
 	{
 		if (monAtk != NULL)
 			return GetMonExceptionMoveType(monAtk, move);
@@ -1315,7 +1274,7 @@ static bool8 AbilityCanChangeTypeAndBoost(u16 move, u8 atkAbility, u8 electrifyT
 
 	if (electrifyTimer > 0
 	|| IsAnyMaxMove(move)
-	|| CheckTableForMove(move, gTypeChangeExceptionMoves))
+	|| IsMoveInTable(move, gTypeChangeExceptionMoves))
 		return FALSE;
 
 	//Check Normal-type Moves
@@ -1842,11 +1801,80 @@ void PopulateDamageCalcStructWithBaseDefenderData(struct DamageCalc* data)
 	}
 
 	data->defenderLoaded = TRUE;
+	data->defenderModifiersApplied = FALSE;
+}
+
+//The defender's stat boosts that don't depend on the move being used. These are applied
+//once per defender so a struct reused for several moves doesn't recalculate them.
+static void ApplyMoveIndependentDefenderModifiers(struct DamageCalc* data)
+{
+	u8 bankDef = data->bankDef;
+	bool8 useMonDef = data->monDef != NULL;
+
+//Target Ability Checks
+	switch (data->defAbility) {
+		case ABILITY_MARVELSCALE:
+		//1.5x Boost
+			if (data->defStatus1 & STATUS_ANY)
+				data->defense = (data->defense * 15) / 10;
+			break;
+
+		case ABILITY_GRASSPELT:
+		//1.5x Boost
+			if (gTerrainType == GRASSY_TERRAIN)
+				data->defense = (data->defense * 15) / 10;
+			break;
+
+		case ABILITY_FURCOAT:
+		//2x Boost
+			data->defense *= 2;
+			break;
+	}
+
+//Target Item Checks
+	switch (data->defItemEffect)
+	{
+		#if (defined OLD_SOUL_DEW_EFFECT && defined SPECIES_LATIOS && defined SPECIES_LATIAS)
+		case ITEM_EFFECT_SOUL_DEW:
+			if (data->defSpecies == SPECIES_LATIOS || data->defSpecies == SPECIES_LATIAS)
+				data->spDefense = (data->spDefense * 3) / 2; //1.5
+			break;
+		#endif
+
+		#ifdef SPECIES_DITTO
+		case ITEM_EFFECT_METAL_POWDER:
+			if (data->defSpecies == SPECIES_DITTO && (useMonDef || !IS_TRANSFORMED(bankDef)))
+				data->defense *= 2;
+			break;
+		#endif
+
+		#ifdef SPECIES_CLAMPERL
+		case ITEM_EFFECT_DEEP_SEA_SCALE:
+			if (data->defSpecies == SPECIES_CLAMPERL)
+				data->spDefense *= 2;
+			break;
+		#endif
+
+		case ITEM_EFFECT_EVIOLITE:
+			if ((useMonDef && CanEvolve(data->monDef))
+			|| (!useMonDef && CanEvolve(GetBankPartyData(bankDef))))
+			{
+				data->defense = (data->defense * 15) / 10;
+				data->spDefense = (data->spDefense * 15) / 10;
+			}
+			break;
+
+		case ITEM_EFFECT_ASSAULT_VEST:
+			data->spDefense = (data->spDefense * 15) / 10;
+			break;
+	}
+
+	data->defenderModifiersApplied = TRUE;
 }
 
 static s32 CalculateBaseDamage(struct DamageCalc* data)
 {
-	u32 attack, spAttack;
+	u32 attack, spAttack, defense, spDefense;
 
 	//Take variables off struct for easier access
 	u8 bankAtk = data->bankAtk;
@@ -1862,6 +1890,32 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 		PopulateDamageCalcStructWithBaseAttackerData(data);
 	if (!data->defenderLoaded)
 		PopulateDamageCalcStructWithBaseDefenderData(data);
+	if (!data->defenderModifiersApplied)
+		ApplyMoveIndependentDefenderModifiers(data);
+
+	defense = data->defense;
+	spDefense = data->spDefense;
+
+//Gym Badge Checks - depend on the attacker, so they can't be applied once with the defender's modifiers
+	#ifdef BADGE_BOOSTS
+	//1.1x Boosts
+		if (!(gBattleTypeFlags & (BATTLE_TYPE_LINK | BATTLE_TYPE_TRAINER_TOWER | BATTLE_TYPE_FRONTIER | BATTLE_TYPE_EREADER_TRAINER))
+		&& gBattleTypeFlags & BATTLE_TYPE_TRAINER
+		&& SIDE(bankAtk) == B_SIDE_PLAYER
+		&& gTrainerBattleOpponent_A != TRAINER_SECRET_BASE)
+		{
+			if (FlagGet(FLAG_BADGE05_GET) && SIDE(bankDef) == B_SIDE_PLAYER)
+				defense = (11 * defense) / 10;
+
+			if (FlagGet(FLAG_BADGE07_GET) && SIDE(bankDef) == B_SIDE_PLAYER)
+				spDefense = (11 * spDefense) / 10;
+		}
+	#endif
+
+//Sandstorm Sp. Def Increase - kept after the badge boosts so the rounding is unchanged
+	if (WEATHER_HAS_EFFECT && (gBattleWeather & WEATHER_SANDSTORM_ANY)
+	&& ((!useMonDef && IsOfType(bankDef, TYPE_ROCK)) || (useMonDef && IsMonOfType(data->monDef, TYPE_ROCK))))
+		spDefense = (15 * spDefense) / 10;
 
 //Load attacker Data
 	if (useMonAtk)
@@ -2079,18 +2133,6 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 
 //Target Ability Checks
 	switch (data->defAbility) {
-		case ABILITY_MARVELSCALE:
-		//1.5x Boost
-			if (data->defStatus1 & STATUS_ANY)
-				data->defense = (data->defense * 15) / 10;
-			break;
-
-		case ABILITY_GRASSPELT:
-		//1.5x Boost
-			if (gTerrainType == GRASSY_TERRAIN)
-				data->defense = (data->defense * 15) / 10;
-			break;
-
 		case ABILITY_THICKFAT:
 		//0.5x Decrement
 			if (data->moveType == TYPE_FIRE || data->moveType == TYPE_ICE)
@@ -2100,11 +2142,6 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 			}
 			break;
 
-		case ABILITY_FURCOAT:
-		//2x Boost
-			data->defense *= 2;
-			break;
-
 		case ABILITY_PORTALPOWER:
 		//0.75x Decrement
 		#ifdef PORTAL_POWER
@@ -2179,44 +2216,6 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 		#endif
 	}
 
-//Target Item Checks
-	switch (data->defItemEffect)
-	{
-		#if (defined OLD_SOUL_DEW_EFFECT && defined SPECIES_LATIOS && defined SPECIES_LATIAS)
-		case ITEM_EFFECT_SOUL_DEW:
-			if (data->defSpecies == SPECIES_LATIOS || data->defSpecies == SPECIES_LATIAS)
-				data->spDefense = (data->spDefense * 3) / 2; //1.5
-			break;
-		#endif
-
-		#ifdef SPECIES_DITTO
-		case ITEM_EFFECT_METAL_POWDER:
-			if (data->defSpecies == SPECIES_DITTO && (useMonDef || !IS_TRANSFORMED(bankDef)))
-				data->defense *= 2;
-			break;
-		#endif
-
-		#ifdef SPECIES_CLAMPERL
-		case ITEM_EFFECT_DEEP_SEA_SCALE:
-			if (data->defSpecies == SPECIES_CLAMPERL)
-				data->spDefense *= 2;
-			break;
-		#endif
-
-		case ITEM_EFFECT_EVIOLITE:
-			if ((useMonDef && CanEvolve(data->monDef))
-			|| (!useMonDef && CanEvolve(GetBankPartyData(bankDef))))
-			{
-				data->defense = (data->defense * 15) / 10;
-				data->spDefense = (data->spDefense * 15) / 10;
-			}
-			break;
-
-		case ITEM_EFFECT_ASSAULT_VEST:
-			data->spDefense = (data->spDefense * 15) / 10;
-			break;
-	}
-
 //Gym Badge Checks
 	#ifdef BADGE_BOOSTS
 	//1.1x Boosts
@@ -2228,26 +2227,15 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 			if (FlagGet(FLAG_BADGE01_GET) && SIDE(bankAtk) == B_SIDE_PLAYER)
 				attack = (11 * attack) / 10;
 
-			if (FlagGet(FLAG_BADGE05_GET) && SIDE(bankDef) == B_SIDE_PLAYER)
-				data->defense = (11 * data->defense) / 10;
-
 			if (FlagGet(FLAG_BADGE07_GET) && SIDE(bankAtk) == B_SIDE_PLAYER)
 				spAttack = (11 * spAttack) / 10;
-
-			if (FlagGet(FLAG_BADGE07_GET) && SIDE(bankDef) == B_SIDE_PLAYER)
-				data->spDefense = (11 * data->spDefense) / 10;
 		}
 	#endif
 
-//Sandstorm Sp. Def Increase
-	if (WEATHER_HAS_EFFECT && (gBattleWeather & WEATHER_SANDSTORM_ANY)
-	&& ((!useMonDef && IsOfType(bankDef, TYPE_ROCK)) || (useMonDef && IsMonOfType(data->monDef, TYPE_ROCK))))
-		data->spDefense = (15 * data->spDefense) / 10;
-
 //Old Exploding Check
 	#ifdef OLD_EXPLOSION_BOOST
 		if (move == MOVE_SELFDESTRUCT || move == MOVE_EXPLOSION)
-			data->defense /= 2;
+			defense /= 2;
 	#endif
 
 //Stat Buffs - Attacker
@@ -2269,20 +2257,20 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 	}
 
 //Stat Buffs - Target
-	if (data->atkAbility != ABILITY_UNAWARE && !useMonDef && !CheckTableForMove(move, gIgnoreStatChangesMoves))
+	if (data->atkAbility != ABILITY_UNAWARE && !useMonDef && !IsMoveInTable(move, gIgnoreStatChangesMoves))
 	{
 		if (gCritMultiplier > BASE_CRIT_MULTIPLIER)
 		{
 			if (data->defBuff < 6)
-				APPLY_QUICK_STAT_MOD(data->defense, data->defBuff);
+				APPLY_QUICK_STAT_MOD(defense, data->defBuff);
 
 			if (data->spDefBuff < 6)
-				APPLY_QUICK_STAT_MOD(data->spDefense, data->spDefBuff);
+				APPLY_QUICK_STAT_MOD(spDefense, data->spDefBuff);
 		}
 		else
 		{
-			APPLY_QUICK_STAT_MOD(data->defense, data->defBuff);
-			APPLY_QUICK_STAT_MOD(data->spDefense, data->spDefBuff);
+			APPLY_QUICK_STAT_MOD(defense, data->defBuff);
+			APPLY_QUICK_STAT_MOD(spDefense, data->spDefBuff);
 		}
 	}
 
@@ -2294,10 +2282,10 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 
 	damage *= power;
 
-	if (CheckTableForMove(move, gSpecialAttackPhysicalDamageMoves))
+	if (IsMoveInTable(move, gSpecialAttackPhysicalDamageMoves))
 	{
 		damage *= spAttack;
-		damage /= MathMax(1, data->defense); //MathMax prevents underflow
+		damage /= MathMax(1, defense); //MathMax prevents underflow
 	}
 	else
 	{
@@ -2305,11 +2293,11 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 			default:
 			case SPLIT_PHYSICAL:
 					damage *= attack;
-					damage /= MathMax(1, data->defense);
+					damage /= MathMax(1, defense);
 					break;
 			case SPLIT_SPECIAL:
 					damage *= spAttack;
-					damage /= MathMax(1, data->spDefense);
+					damage /= MathMax(1, spDefense);
 					break;
 		}
 	}
@@ -2360,7 +2348,7 @@ static s32 CalculateBaseDamage(struct DamageCalc* data)
 	}
 
 	//Stomp Minimize Boost
-	if (data->defStatus3 & STATUS3_MINIMIZED && CheckTableForMove(move, gAlwaysHitWhenMinimizedMoves))
+	if (data->defStatus3 & STATUS3_MINIMIZED && IsMoveInTable(move, gAlwaysHitWhenMinimizedMoves))
 		damage *= 2;
 
 	//Me First Boost
@@ -3094,13 +3082,13 @@ static u16 AdjustBasePower(struct DamageCalc* data, u16 power)
 
 		case ABILITY_RECKLESS:
 		//1.2x Boost
-			if (CheckTableForMove(move, gRecklessBoostedMoves))
+			if (IsMoveInTable(move, gRecklessBoostedMoves))
 				power = (power * 12) / 10;
 			break;
 
 		case ABILITY_IRONFIST:
 		//1.2x Boost
-			if (CheckTableForMove(move, gPunchingMoves))
+			if (IsMoveInTable(move, gPunchingMoves))
 				power = (power * 12) / 10;
 			break;
 
@@ -3125,7 +3113,7 @@ static u16 AdjustBasePower(struct DamageCalc* data, u16 power)
 
 		case ABILITY_SHEERFORCE:
 		//1.3x Boost
-			if (CheckTableForMove(move, gSheerForceBoostedMoves))
+			if (IsMoveInTable(move, gSheerForceBoostedMoves))
 				power = (power * 13) / 10;
 			break;
 
@@ -3148,13 +3136,13 @@ static u16 AdjustBasePower(struct DamageCalc* data, u16 power)
 
 		case ABILITY_MEGALAUNCHER:
 		//1.5x Boost
-			if (CheckTableForMove(move, gPulseAuraMoves))
+			if (IsMoveInTable(move, gPulseAuraMoves))
 				power = (power * 15) / 10;
 			break;
 
 		case ABILITY_STRONGJAW:
 		//1.5x Boost
-			if (CheckTableForMove(move, gBitingMoves))
+			if (IsMoveInTable(move, gBitingMoves))
 				power = (power * 15) / 10;
 			break;
 
@@ -404,10 +404,7 @@ static bool8 PickTileScreen(u8 targetBehaviour, u8 areaX, u8 areaY, s16 *xBuff,
 	{
 		while (topX < botX)
 		{
-			u32 tileBehaviour = MapGridGetMetatileField(topX, topY, 0xFF);
-			u8 blockProperties = GetMetatileAttributeFromRawMetatileBehavior(tileBehaviour, METATILE_ATTRIBUTE_ENCOUNTER_TYPE);
-
-			Var8005 = tileBehaviour;	//020370c2
+			u8 blockProperties = GetCachedMetatileAttributeAt(topX, topY, METATILE_ATTRIBUTE_ENCOUNTER_TYPE);
 
 			//Check NPCs on tile
 			bool8 goNext = FALSE;
@@ -456,6 +453,7 @@ static bool8 PickTileScreen(u8 targetBehaviour, u8 areaX, u8 areaY, s16 *xBuff,
 				{
 					*xBuff = topX;
 					*yBuff = topY;
+					Var8005 = MapGridGetMetatileField(topX, topY, 0xFF);	//020370c2 - raw attributes of the last tile checked
 					return TRUE;
 				}
 			}
@@ -465,6 +463,9 @@ static bool8 PickTileScreen(u8 targetBehaviour, u8 areaX, u8 areaY, s16 *xBuff,
 		topX = gSaveBlock1->pos.x - SCANSTART_X + (smallScan * 5);
 	}
 
+	if (areaX > 0 && areaY > 0)
+		Var8005 = MapGridGetMetatileField(botX - 1, botY - 1, 0xFF);	//020370c2 - raw attributes of the last tile checked
+
 	return FALSE;
 }
 
@@ -494,7 +495,7 @@ static bool8 ShakingGrass(u8 environment, u8 xSize, u8 ySize, bool8 smallScan)
 {
 	if (DexNavPickTile(environment, xSize, ySize, smallScan))
 	{
-		u8 metatileBehaviour = MapGridGetMetatileField(sDNavState->tileX, sDNavState->tileY, 0xFF);
+		u8 metatileBehaviour = GetCachedMetatileBehaviorAt(sDNavState->tileX, sDNavState->tileY);
 		gFieldEffectArguments->effectPos.x = sDNavState->tileX;
 		gFieldEffectArguments->effectPos.y = sDNavState->tileY;
 		gFieldEffectArguments->priority = 0xFF; // height.
@@ -56,39 +56,40 @@ static const item_t sDynamaxBandTable[] =
 
 struct GMaxMove
 {
-	u16 species;
 	u8 moveType;
 	u16 gmaxMove;
 };
 
-static const struct GMaxMove sGMaxMoveTable[] =
-{
-	{SPECIES_CHARIZARD_GIGA,	TYPE_FIRE, 		MOVE_G_MAX_WILDFIRE_P},
-	{SPECIES_BUTTERFREE_GIGA,	TYPE_BUG,		MOVE_G_MAX_BEFUDDLE_P},
-	{SPECIES_PIKACHU_GIGA,		TYPE_ELECTRIC,	MOVE_G_MAX_VOLT_CRASH_P},
-	{SPECIES_MEOWTH_GIGA,		TYPE_NORMAL,	MOVE_G_MAX_GOLD_RUSH_P},
-	{SPECIES_MACHAMP_GIGA,		TYPE_FIGHTING,	MOVE_G_MAX_CHI_STRIKE_P},
-	{SPECIES_GENGAR_GIGA,		TYPE_GHOST,		MOVE_G_MAX_TERROR_P},
-	{SPECIES_KINGLER_GIGA,		TYPE_WATER,		MOVE_G_MAX_FOAM_BURST_P},
-	{SPECIES_LAPRAS_GIGA,		TYPE_ICE,		MOVE_G_MAX_RESONANCE_P},
-	{SPECIES_EEVEE_GIGA,		TYPE_NORMAL,	MOVE_G_MAX_CUDDLE_P},
-	{SPECIES_SNORLAX_GIGA,		TYPE_NORMAL,	MOVE_G_MAX_REPLENISH_P},
-	{SPECIES_GARBODOR_GIGA,		TYPE_POISON,	MOVE_G_MAX_MALODOR_P},
-	{SPECIES_MELMETAL_GIGA,		TYPE_STEEL,		MOVE_G_MAX_MELTDOWN_P},
-	{SPECIES_DREDNAW_GIGA,		TYPE_WATER,		MOVE_G_MAX_STONESURGE_P},
-	{SPECIES_CORVIKNIGHT_GIGA,	TYPE_FLYING,	MOVE_G_MAX_WIND_RAGE_P},
-	{SPECIES_TOXTRICITY_GIGA,	TYPE_ELECTRIC,	MOVE_G_MAX_STUN_SHOCK_P},
-	{SPECIES_ALCREMIE_GIGA,		TYPE_FAIRY,		MOVE_G_MAX_FINALE_P},
-	{SPECIES_DURALUDON_GIGA,	TYPE_DRAGON,	MOVE_G_MAX_DEPLETION_P},
-	{SPECIES_ORBEETLE_GIGA,		TYPE_PSYCHIC,	MOVE_G_MAX_GRAVITAS_P},
-	{SPECIES_COALOSSAL_GIGA,	TYPE_ROCK,		MOVE_G_MAX_VOLCALITH_P},
-	{SPECIES_SANDACONDA_GIGA,	TYPE_GROUND,	MOVE_G_MAX_SANDBLAST_P},
-	{SPECIES_GRIMMSNARL_GIGA,	TYPE_DARK,		MOVE_G_MAX_SNOOZE_P},
-	{SPECIES_FLAPPLE_GIGA,		TYPE_GRASS,		MOVE_G_MAX_TARTNESS_P},
-	{SPECIES_APPLETUN_GIGA,		TYPE_GRASS,		MOVE_G_MAX_SWEETNESS_P},
-	{SPECIES_HATTERENE,			TYPE_FAIRY,		MOVE_G_MAX_SMITE_P},
-	{SPECIES_COPPERAJAH_GIGA,	TYPE_STEEL,		MOVE_G_MAX_STEELSURGE_P},
-	{SPECIES_CENTISKORCH_GIGA,	TYPE_FIRE, 		MOVE_G_MAX_CENTIFERNO_P},
+//Indexed by the species' place among the Gigantamax forms so the lookup doesn't need to search
+#define GMAX_MOVE_INDEX(species) ((species) - SPECIES_VENUSAUR_GIGA)
+static const struct GMaxMove sGMaxMoveTable[GMAX_MOVE_INDEX(SPECIES_URSHIFU_RAPID_GIGA) + 1] =
+{
+	[GMAX_MOVE_INDEX(SPECIES_CHARIZARD_GIGA)] =		{TYPE_FIRE,		MOVE_G_MAX_WILDFIRE_P},
+	[GMAX_MOVE_INDEX(SPECIES_BUTTERFREE_GIGA)] =	{TYPE_BUG,		MOVE_G_MAX_BEFUDDLE_P},
+	[GMAX_MOVE_INDEX(SPECIES_PIKACHU_GIGA)] =		{TYPE_ELECTRIC,	MOVE_G_MAX_VOLT_CRASH_P},
+	[GMAX_MOVE_INDEX(SPECIES_MEOWTH_GIGA)] =		{TYPE_NORMAL,	MOVE_G_MAX_GOLD_RUSH_P},
+	[GMAX_MOVE_INDEX(SPECIES_MACHAMP_GIGA)] =		{TYPE_FIGHTING,	MOVE_G_MAX_CHI_STRIKE_P},
+	[GMAX_MOVE_INDEX(SPECIES_GENGAR_GIGA)] =		{TYPE_GHOST,	MOVE_G_MAX_TERROR_P},
+	[GMAX_MOVE_INDEX(SPECIES_KINGLER_GIGA)] =		{TYPE_WATER,	MOVE_G_MAX_FOAM_BURST_P},
+	[GMAX_MOVE_INDEX(SPECIES_LAPRAS_GIGA)] =		{TYPE_ICE,		MOVE_G_MAX_RESONANCE_P},
+	[GMAX_MOVE_INDEX(SPECIES_EEVEE_GIGA)] =			{TYPE_NORMAL,	MOVE_G_MAX_CUDDLE_P},
+	[GMAX_MOVE_INDEX(SPECIES_SNORLAX_GIGA)] =		{TYPE_NORMAL,	MOVE_G_MAX_REPLENISH_P},
+	[GMAX_MOVE_INDEX(SPECIES_GARBODOR_GIGA)] =		{TYPE_POISON,	MOVE_G_MAX_MALODOR_P},
+	[GMAX_MOVE_INDEX(SPECIES_MELMETAL_GIGA)] =		{TYPE_STEEL,	MOVE_G_MAX_MELTDOWN_P},
+	[GMAX_MOVE_INDEX(SPECIES_DREDNAW_GIGA)] =		{TYPE_WATER,	MOVE_G_MAX_STONESURGE_P},
+	[GMAX_MOVE_INDEX(SPECIES_CORVIKNIGHT_GIGA)] =	{TYPE_FLYING,	MOVE_G_MAX_WIND_RAGE_P},
+	[GMAX_MOVE_INDEX(SPECIES_TOXTRICITY_GIGA)] =	{TYPE_ELECTRIC,	MOVE_G_MAX_STUN_SHOCK_P},
+	[GMAX_MOVE_INDEX(SPECIES_ALCREMIE_GIGA)] =		{TYPE_FAIRY,	MOVE_G_MAX_FINALE_P},
+	[GMAX_MOVE_INDEX(SPECIES_DURALUDON_GIGA)] =		{TYPE_DRAGON,	MOVE_G_MAX_DEPLETION_P},
+	[GMAX_MOVE_INDEX(SPECIES_ORBEETLE_GIGA)] =		{TYPE_PSYCHIC,	MOVE_G_MAX_GRAVITAS_P},
+	[GMAX_MOVE_INDEX(SPECIES_COALOSSAL_GIGA)] =		{TYPE_ROCK,		MOVE_G_MAX_VOLCALITH_P},
+	[GMAX_MOVE_INDEX(SPECIES_SANDACONDA_GIGA)] =	{TYPE_GROUND,	MOVE_G_MAX_SANDBLAST_P},
+	[GMAX_MOVE_INDEX(SPECIES_GRIMMSNARL_GIGA)] =	{TYPE_DARK,		MOVE_G_MAX_SNOOZE_P},
+	[GMAX_MOVE_INDEX(SPECIES_FLAPPLE_GIGA)] =		{TYPE_GRASS,	MOVE_G_MAX_TARTNESS_P},
+	[GMAX_MOVE_INDEX(SPECIES_APPLETUN_GIGA)] =		{TYPE_GRASS,	MOVE_G_MAX_SWEETNESS_P},
+	[GMAX_MOVE_INDEX(SPECIES_HATTERENE_GIGA)] =		{TYPE_FAIRY,	MOVE_G_MAX_SMITE_P},
+	[GMAX_MOVE_INDEX(SPECIES_COPPERAJAH_GIGA)] =	{TYPE_STEEL,	MOVE_G_MAX_STEELSURGE_P},
+	[GMAX_MOVE_INDEX(SPECIES_CENTISKORCH_GIGA)] =	{TYPE_FIRE,		MOVE_G_MAX_CENTIFERNO_P},
 };
 
 const u8 gRaidBattleStarsByBadges[NUM_BADGE_OPTIONS][2] =
@@ -351,11 +352,23 @@ static item_t FindPlayerDynamaxBand(void)
 		if (dynamaxBand != ITEM_NONE)
 			return dynamaxBand;
 	#else
-		for (u8 i = 0; i < ARRAY_COUNT(sDynamaxBandTable); ++i)
+		if (!gNewBS->dynamaxData.playerDynamaxBandLoaded)
 		{
-			if (CheckBagHasItem(sDynamaxBandTable[i], 1))
-				return sDynamaxBandTable[i];
+			gNewBS->dynamaxData.playerDynamaxBand = ITEM_NONE;
+			gNewBS->dynamaxData.playerDynamaxBandLoaded = TRUE;
+
+			for (u8 i = 0; i < ARRAY_COUNT(sDynamaxBandTable); ++i)
+			{
+				if (CheckBagHasItem(sDynamaxBandTable[i], 1))
+				{
+					gNewBS->dynamaxData.playerDynamaxBand = sDynamaxBandTable[i];
+					break;
+				}
+			}
 		}
+
+		if (gNewBS->dynamaxData.playerDynamaxBand != ITEM_NONE)
+			return gNewBS->dynamaxData.playerDynamaxBand;
 	#endif
 
 	#ifdef DEBUG_DYNAMAX
@@ -473,24 +486,13 @@ static move_t GetTypeBasedMaxMove(u8 moveType, u8 moveSplit)
 		return MOVE_MAX_STRIKE_P + ((moveType - 1) * 2) + moveSplit;
 }
 
-static u8 GetMaxMoveType(u16 move, u8 bank, struct Pokemon* mon)
+static u8 GetMaxMoveType(u16 move, u8 moveSplit, u8 bank, struct Pokemon* mon)
 {
 	u8 moveType = GetMoveTypeSpecialPreAbility(move, bank, mon);
 
 	if (moveType == 0xFF) //No overridden type
 	{
-		u8 moveSplit, ability;
-
-		if (mon != NULL)
-		{
-			moveSplit = CalcMoveSplitFromParty(mon, move);
-			ability = GetMonAbility(mon);
-		}
-		else
-		{
-			moveSplit = CalcMoveSplit(bank, move);
-			ability = ABILITY(bank);
-		}
+		u8 ability = (mon != NULL) ? GetMonAbility(mon) : ABILITY(bank);
 
 		//Try to modify Max Move's type using ability
 		u16 maxMove = GetTypeBasedMaxMove(gBattleMoves[move].type, moveSplit);
@@ -502,14 +504,12 @@ static u8 GetMaxMoveType(u16 move, u8 bank, struct Pokemon* mon)
 
 static move_t GetGMaxMove(u8 moveType, u8 moveSplit, u16 species)
 {
-	for (u32 i = 0; i < ARRAY_COUNT(sGMaxMoveTable); ++i)
-	{
-		if (sGMaxMoveTable[i].species == species
-		&&  sGMaxMoveTable[i].moveType == moveType)
-		{
-			return sGMaxMoveTable[i].gmaxMove + moveSplit;
-		}
-	}
+	u32 index = GMAX_MOVE_INDEX(species); //Underflows for species below the Gigantamax forms
+
+	if (index < ARRAY_COUNT(sGMaxMoveTable)
+	&& sGMaxMoveTable[index].gmaxMove != MOVE_NONE
+	&& sGMaxMoveTable[index].moveType == moveType)
+		return sGMaxMoveTable[index].gmaxMove + moveSplit;
 
 	return MOVE_NONE;
 }
@@ -522,7 +522,7 @@ move_t GetMaxMove(u8 bank, u8 moveIndex)
 
 move_t GetMaxMoveByMove(u8 bank, u16 baseMove)
 {
-	u8 moveSplit = CalcMoveSplit(bank, baseMove);
+	u8 moveSplit;
 
 	if (baseMove == MOVE_NONE)
 		return MOVE_NONE;
@@ -535,10 +535,11 @@ move_t GetMaxMoveByMove(u8 bank, u16 baseMove)
 			return MOVE_NONE;
 	}
 
+	moveSplit = CalcMoveSplit(bank, baseMove);
 	if (moveSplit == SPLIT_STATUS)
 		return MOVE_MAX_GUARD;
 
-	u8 moveType = GetMaxMoveType(baseMove, bank, NULL);
+	u8 moveType = GetMaxMoveType(baseMove, moveSplit, bank, NULL);
 	u16 maxMove = GetGMaxMove(moveType, moveSplit, SPECIES(bank));
 	if (maxMove != MOVE_NONE)
 		return maxMove;
@@ -548,8 +549,8 @@ move_t GetMaxMoveByMove(u8 bank, u16 baseMove)
 
 static move_t GetMonMaxMove(struct Pokemon* mon, u16 baseMove)
 {
-	u8 moveType = GetMaxMoveType(baseMove, 0, mon);
 	u8 moveSplit = CalcMoveSplitFromParty(mon, baseMove);
+	u8 moveType = GetMaxMoveType(baseMove, moveSplit, 0, mon);
 	u16 maxMove = GetGMaxMove(moveType, moveSplit, mon->species);
 	if (maxMove != MOVE_NONE)
 		return maxMove;
@@ -1250,7 +1251,7 @@ bool8 ProtectedByMaxGuard(u8 bankDef, u16 move)
 		if (gBattleMoves[move].target & (MOVE_TARGET_DEPENDS | MOVE_TARGET_OPPONENTS_FIELD))
 			return (gBattleMoves[move].flags & FLAG_PROTECT_AFFECTED) != 0;
 
-		if (gBattleMoves[move].target & MOVE_TARGET_ALL && CheckTableForMove(gCurrentMove, gSpecialWholeFieldMoves))
+		if (gBattleMoves[move].target & MOVE_TARGET_ALL && IsMoveInTable(gCurrentMove, gSpecialWholeFieldMoves))
 			return FALSE;
 
 		return TRUE;
@@ -129,6 +129,7 @@ u8 TurnBasedEffects(void)
 				{
 					gBanksByTurnOrder[i] = i;
 				}
+				TakeSpeedSnapshot();
 				for (i = 0; i < gBattlersCount - 1; ++i)
 				{
 					for (j = i + 1; j < gBattlersCount; ++j)
@@ -137,6 +138,7 @@ u8 TurnBasedEffects(void)
 							SwapTurnOrder(i, j);
 					}
 				}
+				ClearSpeedSnapshot();
 				++gBattleStruct->turnEffectsTracker;
 			__attribute__ ((fallthrough));
 
@@ -1470,6 +1472,7 @@ u8 TurnBasedEffects(void)
 							gNewBS->ai.damageByMove[i][j][k] = 0xFFFFFFFF;
 							gNewBS->ai.moveKnocksOut1Hit[i][j][k] = 0xFF;
 							gNewBS->ai.moveKnocksOut2Hits[i][j][k] = 0xFF;
+							gNewBS->ai.maxRollDamageByMove[i][j][k] = 0xFFFFFFFF;
 						}
 					}
 				}
@@ -1818,6 +1821,7 @@ bool8 HandleFaintedMonActions(void)
 				}
 				gNewBS->doSwitchInEffects = FALSE;
 
+				TakeSpeedSnapshot();
 				for (i = 0; i < gBattlersCount - 1; ++i)
 				{
 					for (j = i + 1; j < gBattlersCount; ++j)
@@ -1826,6 +1830,7 @@ bool8 HandleFaintedMonActions(void)
 							SwapTurnOrder(i, j);
 					}
 				}
+				ClearSpeedSnapshot();
 
 				gBattleStruct->faintedActionsBank = 0;
 				gBattleStruct->faintedActionsState++;
@@ -28,6 +28,7 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 	u8 beauty = mon->beauty;
 	u16 upperPersonality = personality >> 16;
 	u8 holdEffect = ItemId_GetHoldEffect(heldItem);
+	const struct Evolution* evolutions = gEvolutionTable[species]; //Resolve the repointed table once instead of per entry
 
 	if (holdEffect == ITEM_EFFECT_PREVENT_EVOLVE && type != 3)
 		return SPECIES_NONE;
@@ -40,79 +41,81 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 
 		for (i = 0; i < EVOS_PER_MON; ++i)
 		{
-			switch (gEvolutionTable[species][i].method)
+			switch (evolutions[i].method)
 			{
 				case EVO_FRIENDSHIP:
 					if (friendship >= 220)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_FRIENDSHIP_DAY:
 				#ifdef TIME_ENABLED
 					if (IsDayTime() && friendship >= 220)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						targetSpecies = evolutions[i].targetSpecies;
 				#endif
 					break;
 
 				case EVO_FRIENDSHIP_NIGHT:
 				#ifdef TIME_ENABLED
 					if (IsNightTime() && friendship >= 220)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						targetSpecies = evolutions[i].targetSpecies;
 				#endif
 					break;
 
 				case EVO_LEVEL:
-					if (gEvolutionTable[species][i].param <= level)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_ATK_GT_DEF:
-					if (gEvolutionTable[species][i].param <= level)
+					if (evolutions[i].param <= level)
 						if (mon->attack > mon->defense)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_ATK_EQ_DEF:
-					if (gEvolutionTable[species][i].param <= level)
+					if (evolutions[i].param <= level)
 						if (mon->attack == mon->defense)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_ATK_LT_DEF:
-					if (gEvolutionTable[species][i].param <= level)
+					if (evolutions[i].param <= level)
 						if (mon->attack < mon->defense)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_SILCOON:
-					if (gEvolutionTable[species][i].param <= level && (upperPersonality % 10) <= 4)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level && (upperPersonality % 10) <= 4)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_CASCOON:
-					if (gEvolutionTable[species][i].param <= level && (upperPersonality % 10) > 4)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level && (upperPersonality % 10) > 4)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_NINJASK:
-					if (gEvolutionTable[species][i].param <= level)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_BEAUTY:
-					if (gEvolutionTable[species][i].param <= beauty)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= beauty)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_RAINY_FOGGY_OW:
-					if (gEvolutionTable[species][i].param <= level
-					&& (GetCurrentWeather() == WEATHER_RAIN_LIGHT
-					 || GetCurrentWeather() == WEATHER_RAIN_MED
-					 || GetCurrentWeather() == WEATHER_RAIN_HEAVY
-					 || GetCurrentWeather() == WEATHER_FOG_1
-					 || GetCurrentWeather() == WEATHER_FOG_2))
+					if (evolutions[i].param <= level)
 					{
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						switch (GetCurrentWeather()) {
+							case WEATHER_RAIN_LIGHT:
+							case WEATHER_RAIN_MED:
+							case WEATHER_RAIN_HEAVY:
+							case WEATHER_FOG_1:
+							case WEATHER_FOG_2:
+								targetSpecies = evolutions[i].targetSpecies;
+						}
 					}
 					break;
 
@@ -120,9 +123,9 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 					// move type to know in param
 					for (j = 0; j < MAX_MON_MOVES; ++j)
 					{
-						if (gBattleMoves[mon->moves[j]].type == gEvolutionTable[species][i].param)
+						if (gBattleMoves[mon->moves[j]].type == evolutions[i].param)
 						{
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 							break;
 						}
 					}
@@ -133,9 +136,9 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 					// type in unknown
 					// eg. Pancham table would be:
 					//		[SPECIES_PANCHAM] = {{EVO_TYPE_IN_PARTY, 32, SPECIES_PANGORO, TYPE_DARK}},
-					if (level >= gEvolutionTable[species][i].param)
+					if (level >= evolutions[i].param)
 					{
-						u8 typeCheck = gEvolutionTable[species][i].unknown;
+						u8 typeCheck = evolutions[i].unknown;
 						if (typeCheck >= NUMBER_OF_MON_TYPES)
 							break;
 						for (j = 0; j < gPlayerPartyCount; ++j)
@@ -143,7 +146,7 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 							if (gBaseStats[gPlayerParty[j].species].type1 == typeCheck
 							||  gBaseStats[gPlayerParty[j].species].type2 == typeCheck)
 							{
-								targetSpecies = gEvolutionTable[species][i].targetSpecies;
+								targetSpecies = evolutions[i].targetSpecies;
 								break;
 							}
 						}
@@ -151,45 +154,45 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 					break;
 
 				case EVO_MAP:
-					if (GetCurrentRegionMapSectionId() == gEvolutionTable[species][i].param) //Based on map name
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (GetCurrentRegionMapSectionId() == evolutions[i].param) //Based on map name
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_MALE_LEVEL:
-					if (gEvolutionTable[species][i].param <= level && GetMonGender(mon) == MON_MALE)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level && GetMonGender(mon) == MON_MALE)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_FEMALE_LEVEL:
-					if (gEvolutionTable[species][i].param <= level && GetMonGender(mon) == MON_FEMALE)
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (evolutions[i].param <= level && GetMonGender(mon) == MON_FEMALE)
+						targetSpecies = evolutions[i].targetSpecies;
 					break;
 
 				case EVO_LEVEL_NIGHT:
 					#ifdef TIME_ENABLED
-						if (gEvolutionTable[species][i].param <= level && IsNightTime())
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						if (evolutions[i].param <= level && IsNightTime())
+							targetSpecies = evolutions[i].targetSpecies;
 					#else  // regular level up check
-						if (gEvolutionTable[species][i].param <= level)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						if (evolutions[i].param <= level)
+							targetSpecies = evolutions[i].targetSpecies;
 					#endif
 					break;
 
 				case EVO_LEVEL_DAY:
 					#ifdef TIME_ENABLED
-						if (gEvolutionTable[species][i].param <= level && IsDayTime())
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						if (evolutions[i].param <= level && IsDayTime())
+							targetSpecies = evolutions[i].targetSpecies;
 					#else  // regular level up check
-						if (gEvolutionTable[species][i].param <= level)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						if (evolutions[i].param <= level)
+							targetSpecies = evolutions[i].targetSpecies;
 					#endif
 					break;
 
 				case EVO_HOLD_ITEM_NIGHT:
 					#ifdef TIME_ENABLED
-					if (heldItem == gEvolutionTable[species][i].param && IsNightTime())
+					if (heldItem == evolutions[i].param && IsNightTime())
 					{
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						targetSpecies = evolutions[i].targetSpecies;
 						#ifdef EVO_HOLD_ITEM_REMOVAL
 							FlagSet(FLAG_REMOVE_EVO_ITEM);
 						#endif
@@ -200,9 +203,9 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 				case EVO_HOLD_ITEM_DAY:
 					// hold item in param
 					#ifdef TIME_ENABLED
-					if (heldItem == gEvolutionTable[species][i].param && IsDayTime())
+					if (heldItem == evolutions[i].param && IsDayTime())
 					{
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						targetSpecies = evolutions[i].targetSpecies;
 						#ifdef EVO_HOLD_ITEM_REMOVAL
 							FlagSet(FLAG_REMOVE_EVO_ITEM);
 						#endif
@@ -213,9 +216,9 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 				case EVO_MOVE:
 					for (j = 0; j < MAX_MON_MOVES; ++j)
 					{
-						if (gEvolutionTable[species][i].param == mon->moves[j])
+						if (evolutions[i].param == mon->moves[j])
 						{
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 							break;
 						}
 					}
@@ -225,9 +228,9 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 					// species to check for in param
 					for (j = 0; j < gPlayerPartyCount; ++j)
 					{
-						if (gPlayerParty[j].species == gEvolutionTable[species][i].param)
+						if (gPlayerParty[j].species == evolutions[i].param)
 						{
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 							break;
 						}
 					}
@@ -235,20 +238,20 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 
 				case EVO_LEVEL_SPECIFIC_TIME_RANGE: ;
 					#ifdef TIME_ENABLED
-						u8 startTime = (gEvolutionTable[species][i].unknown >> 8) & 0xFF;	//upper byte
-						u8 endTime = gEvolutionTable[species][i].unknown & 0xFF;	// lower byte
-						if (gEvolutionTable[species][i].param <= level
+						u8 startTime = (evolutions[i].unknown >> 8) & 0xFF;	//upper byte
+						u8 endTime = evolutions[i].unknown & 0xFF;	// lower byte
+						if (evolutions[i].param <= level
 						&& (gClock.hour >= startTime && gClock.hour < endTime))
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+							targetSpecies = evolutions[i].targetSpecies;
 					#else  // regular level up check
-						if (gEvolutionTable[species][i].param <= level)
-							targetSpecies = gEvolutionTable[species][i].targetSpecies;
+						if (evolutions[i].param <= level)
+							targetSpecies = evolutions[i].targetSpecies;
 					#endif
 					break;
 
 				case EVO_FLAG_SET:
-					if (FlagGet(gEvolutionTable[species][i].param))
-						targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					if (FlagGet(evolutions[i].param))
+						targetSpecies = evolutions[i].targetSpecies;
 			}
 		}
 		break;
@@ -256,18 +259,18 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 	case 1:
 		for (i = 0; i < EVOS_PER_MON; ++i)
 		{
-			switch (gEvolutionTable[species][i].method)
+			switch (evolutions[i].method)
 			{
 			case EVO_TRADE:
-				targetSpecies = gEvolutionTable[species][i].targetSpecies;
+				targetSpecies = evolutions[i].targetSpecies;
 				break;
 			#ifdef EVO_HOLD_ITEM_REMOVAL
 			case EVO_TRADE_ITEM:
-				if (gEvolutionTable[species][i].param == heldItem)
+				if (evolutions[i].param == heldItem)
 				{
 					heldItem = 0;
 					SetMonData(mon, MON_DATA_HELD_ITEM, &heldItem);
-					targetSpecies = gEvolutionTable[species][i].targetSpecies;
+					targetSpecies = evolutions[i].targetSpecies;
 				}
 				break;
 			#endif
@@ -279,12 +282,12 @@ u16 GetEvolutionTargetSpecies(struct Pokemon* mon, u8 type, u16 evolutionItem)
 	case 3:	// using items
 		for (i = 0; i < EVOS_PER_MON; ++i)
 		{
-			if (gEvolutionTable[species][i].method == EVO_ITEM
-			 && gEvolutionTable[species][i].param == evolutionItem)
+			if (evolutions[i].method == EVO_ITEM
+			 && evolutions[i].param == evolutionItem)
 			{
-				if (evolutionItem == ITEM_DAWN_STONE && GetMonGender(mon) != gEvolutionTable[species][i].unknown)
+				if (evolutionItem == ITEM_DAWN_STONE && GetMonGender(mon) != evolutions[i].unknown)
 					break;
-				targetSpecies = gEvolutionTable[species][i].targetSpecies;
+				targetSpecies = evolutions[i].targetSpecies;
 				break;
 			}
 		}
@@ -697,6 +697,7 @@ static void MonGainEVs(struct Pokemon *mon, u16 defeatedSpecies)
 {
 	u8 multiplier;
 	u16 evIncrease;
+	u8 evYields[NUM_STATS];
 
 	u16 heldItem = GetMonData(mon, MON_DATA_HELD_ITEM, NULL);
 	u8 holdEffect = ItemId_GetHoldEffect(heldItem);
@@ -705,45 +706,29 @@ static void MonGainEVs(struct Pokemon *mon, u16 defeatedSpecies)
 	if (GetMonEVCount(mon) >= MAX_TOTAL_EVS)
 		return;
 
+	//Pokerus
+	multiplier = (CheckPartyHasHadPokerus(mon, 0)) ? 2 : 1;
+
+	//Check Macho Brace
+	if (holdEffect == ITEM_EFFECT_MACHO_BRACE && itemQuality == QUALITY_MACHO_BRACE)
+		multiplier *= 2;
+
+	//Get EV yield
+	evYields[STAT_HP] = gBaseStats[defeatedSpecies].evYield_HP;
+	evYields[STAT_ATK] = gBaseStats[defeatedSpecies].evYield_Attack;
+	evYields[STAT_DEF] = gBaseStats[defeatedSpecies].evYield_Defense;
+	evYields[STAT_SPEED] = gBaseStats[defeatedSpecies].evYield_Speed;
+	evYields[STAT_SPATK] = gBaseStats[defeatedSpecies].evYield_SpAttack;
+	evYields[STAT_SPDEF] = gBaseStats[defeatedSpecies].evYield_SpDefense;
+
 	for (u8 stat = 0; stat < NUM_STATS; ++stat)
 	{
 		if (GetMonData(mon, MON_DATA_HP_EV + stat, NULL) >= EV_CAP)
 			continue;
 
-		evIncrease = 0;
-		multiplier = (CheckPartyHasHadPokerus(mon, 0)) ? 2 : 1;
-
-		//Get EV yield
-		switch (stat)
-		{
-			case STAT_HP:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_HP;
-				break;
-			case STAT_ATK:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_Attack;
-				break;
-			case STAT_DEF:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_Defense;
-				break;
-			case STAT_SPEED:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_Speed;
-				break;
-			case STAT_SPATK:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_SpAttack;
-				break;
-			case STAT_SPDEF:
-				evIncrease = gBaseStats[defeatedSpecies].evYield_SpDefense;
-				break;
-		}
-
-		//Pokerus
-		evIncrease *= multiplier;
-
-		//Check Macho Brace
-		if (holdEffect == ITEM_EFFECT_MACHO_BRACE && itemQuality == QUALITY_MACHO_BRACE)
-			evIncrease *= 2;
-
-		AddEVs(mon, stat, evIncrease);
+		evIncrease = evYields[stat] * multiplier;
+		if (evIncrease > 0) //Most species only yield one or two stats
+			AddEVs(mon, stat, evIncrease);
 
 		if (holdEffect == ITEM_EFFECT_MACHO_BRACE && itemQuality > 0 && itemQuality - 1 == stat)
 			AddEVs(mon, stat, POWER_ITEM_EV_YIELD); //Power items always add to requested stat
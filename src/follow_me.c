@@ -51,6 +51,7 @@ static void CalculateFollowerEscalatorTrajectoryUp(struct Task *task);
 static void CalculateFollowerEscalatorTrajectoryDown(struct Task *task);
 static void SetFollowerSprite(u8 spriteIndex);
 static void TurnNPCIntoFollower(u8 localId, u8 followerFlags);
+static bool8 ShouldFollowerIgnoreActiveScript(void);
 
 #undef gFieldEffectArguments
 #define gFieldEffectArguments ((u32*) 0x20386E0)
@@ -223,7 +224,7 @@ void FollowMe(struct EventObject* npc, u8 state, bool8 ignoreScriptActive)
 	if (!gFollowerState.inProgress)
 		return;
 
-	if (ScriptContext2_IsEnabled() && !ignoreScriptActive)
+	if (ScriptContext2_IsEnabled() && !ignoreScriptActive && !ShouldFollowerIgnoreActiveScript())
 		return; //Don't follow during a script
 
 	struct EventObject* follower = &gEventObjects[GetFollowerMapObjId()];
@@ -686,7 +687,7 @@ static bool8 PlayerIsUnderAndFacingWaterfall(void)
 	x = player->currentCoords.x;
 	y = player->currentCoords.y;
 	MoveCoords(DIR_NORTH, &x, &y);
-	if (MetatileBehavior_IsWaterfall(MapGridGetMetatileBehaviorAt(x, y)))
+	if (MetatileBehavior_IsWaterfall(GetCachedMetatileBehaviorAt(x, y)))
 		return TRUE;
 
 	return FALSE;
@@ -737,16 +738,10 @@ void FollowMe_Ledges(struct EventObject* npc, struct Sprite* sprite, u16* ledgeF
 
 bool8 FollowMe_IsCollisionExempt(struct EventObject* obstacle, struct EventObject* collider)
 {
-	if (!gFollowerState.inProgress)
-		return FALSE;
-
-	struct EventObject* follower = &gEventObjects[GetFollowerMapObjId()];
-	struct EventObject* player = &gEventObjects[gPlayerAvatar->eventObjectId];
-
-	if (obstacle == follower && collider == player)
-		return TRUE;
-
-	return FALSE;
+	//Called for every object on every collision check, so the cheap checks go first
+	return gFollowerState.inProgress
+		&& collider->isPlayer
+		&& obstacle == &gEventObjects[GetFollowerMapObjId()];
 }
 
 void FollowMe_FollowerToWater(void)
@@ -1103,7 +1098,7 @@ static void Task_FollowerHandleEscalatorFinish(u8 taskId)
 		case 0:
 			MoveEventObjectToMapCoords(follower, player->currentCoords.x, player->currentCoords.y);
 			PlayerGetDestCoords(&x, &y);
-			task->data[2] = MapGridGetMetatileBehaviorAt(x, y);
+			task->data[2] = GetCachedMetatileBehaviorAt(x, y);
 			task->data[7] = 0;
 			task->data[0]++;
 			break;
@@ -1407,7 +1402,7 @@ void sp0E1_DoesPlayerHaveFollower(void)
 	gSpecialVar_LastResult = gFollowerState.inProgress;
 }
 
-bool8 ShouldFollowerIgnoreActiveScript(void)
+static bool8 ShouldFollowerIgnoreActiveScript(void)
 {
 	#ifdef FLAG_FOLLOWER_IGNORE_ACTIVE_SCRIPT
 	return FlagGet(FLAG_FOLLOWER_IGNORE_ACTIVE_SCRIPT);
@@ -136,7 +136,7 @@ void atk02_attackstring(void)
 			if (IsAnyMaxMove(gCurrentMove))
 				gNewBS->LastUsedMove = gChosenMove;
 
-			if (!CheckTableForMove(gCurrentMove, gMovesThatCallOtherMoves))
+			if (!IsMoveInTable(gCurrentMove, gMovesThatCallOtherMoves))
 			{
 				u8 chargingBonus = 20 * gNewBS->metronomeItemBonus[gBankAttacker];
 				if (gLastPrintedMoves[gBankAttacker] == gCurrentMove)
@@ -152,7 +152,7 @@ void atk02_attackstring(void)
 
 			if (ABILITY(gBankAttacker) == ABILITY_PROTEAN
 			&& !(gMoveResultFlags & MOVE_RESULT_FAILED)
-			&& !CheckTableForMove(gCurrentMove, gMovesThatCallOtherMoves))
+			&& !IsMoveInTable(gCurrentMove, gMovesThatCallOtherMoves))
 			{
 				if (gBattleMons[gBankAttacker].type1 != moveType
 				||  gBattleMons[gBankAttacker].type2 != moveType
@@ -3096,7 +3096,7 @@ void atk9D_mimicattackcopy(void)
 	if (gBattleMons[gBankAttacker].status2 & STATUS2_TRANSFORMED
 	|| gLastUsedMoves[gBankTarget] == 0
 	|| gLastUsedMoves[gBankTarget] == 0xFFFF
-	|| CheckTableForMove(gLastUsedMoves[gBankTarget], gMimicBannedMoves)
+	|| IsMoveInTable(gLastUsedMoves[gBankTarget], gMimicBannedMoves)
 	|| IsZMove(gLastUsedMoves[gBankTarget])
 	|| IsAnyMaxMove(gLastUsedMoves[gBankTarget]))
 	{
@@ -3135,7 +3135,7 @@ void atk9E_metronome(void)
 	{
 		gCurrentMove = umodsi(Random(), LAST_MOVE_INDEX) + 1;
 	} while (IsZMove(gCurrentMove) || IsAnyMaxMove(gCurrentMove)
-		|| CheckTableForMove(gCurrentMove, gMetronomeBannedMoves));
+		|| IsMoveInTable(gCurrentMove, gMetronomeBannedMoves));
 
 	TryUpdateCalledMoveWithZMove();
 	UpdateMoveStartValuesForCalledMove();
@@ -3239,7 +3239,7 @@ void atkA4_trysetencore(void)
 	if (gLastUsedMoves[gBankTarget] == MOVE_STRUGGLE
 	||  gLastUsedMoves[gBankTarget] == MOVE_ENCORE
 	||  gNewBS->playedShellTrapMessage & gBitTable[gBankTarget]
-	||  CheckTableForMove(gLastUsedMoves[gBankTarget], gMovesThatCallOtherMoves)
+	||  IsMoveInTable(gLastUsedMoves[gBankTarget], gMovesThatCallOtherMoves)
 	||  IsZMove(gLastUsedMoves[gBankTarget])
 	||  IsAnyMaxMove(gLastUsedMoves[gBankTarget])
 	||  IsDynamaxed(gBankTarget))
@@ -3435,7 +3435,7 @@ void atkA9_trychoosesleeptalkmove(void) {
 	int i;
 
 	for (i = 0; i < 4; ++i) {
-		if (CheckTableForMove(gBattleMons[gBankAttacker].moves[i], gSleepTalkBannedMoves))
+		if (IsMoveInTable(gBattleMons[gBankAttacker].moves[i], gSleepTalkBannedMoves))
 			unusable_moves |= gBitTable[i];
 	}
 
@@ -4634,7 +4634,7 @@ void atkDE_asistattackselect(void)
 		{
 			u16 move = party[monId].moves[moveId];
 
-			if (CheckTableForMove(move, gAssistBannedMoves))
+			if (IsMoveInTable(move, gAssistBannedMoves))
 				continue;
 
 			if (move == MOVE_NONE)
@@ -881,7 +881,7 @@ u8 ItemBattleEffects(u8 caseID, u8 bank, bool8 moveTurn, bool8 doPluck)
 					&& TOOK_DAMAGE(gBankTarget)
 					&& MOVE_HAD_EFFECT
 					&& (umodsi(Random(), 100)) < bankQuality
-					&& !CheckTableForMove(gCurrentMove, gFlinchChanceMoves)
+					&& !IsMoveInTable(gCurrentMove, gFlinchChanceMoves)
 					&& gBattleMons[gBankTarget].hp)
 					{
 						gBattleMons[gBankTarget].status2 |= STATUS2_FLINCHED;
@@ -8,9 +8,15 @@ link.c
 	handles data transfer
 */
 
+//The header matches the vanilla controllers, which read it themselves:
+//[0] = command, [1..4] = destination, [5..6] = size, then the payload
+#define DATA_TRANSFER_HEADER_SIZE 7
+
 void EmitDataTransfer(u8 bufferId, void* dst, u16 size, void* data)
 {
-	s32 i;
+	//Outside of link battles both ends share the same memory, so copying data back onto itself would do nothing
+	if (dst == data && !(gBattleTypeFlags & BATTLE_TYPE_LINK))
+		size = 0;
 
 	gBattleBuffersTransferData[0] = CONTROLLER_DATATRANSFER;
 	gBattleBuffersTransferData[1] = (u32)(dst);
@@ -19,36 +25,20 @@ void EmitDataTransfer(u8 bufferId, void* dst, u16 size, void* data)
 	gBattleBuffersTransferData[4] = ((u32)(dst) & 0xFF000000) >> 24;
 	gBattleBuffersTransferData[5] = size;
 	gBattleBuffersTransferData[6] = (size & 0xFF00) >> 8;
-	for (i = 0; i < size; i++)
-		gBattleBuffersTransferData[7 + i] = *(u8*)(data++);
-	PrepareBufferDataTransfer(bufferId, gBattleBuffersTransferData, size + 7);
+	Memcpy(&gBattleBuffersTransferData[DATA_TRANSFER_HEADER_SIZE], data, size);
+	PrepareBufferDataTransfer(bufferId, gBattleBuffersTransferData, size + DATA_TRANSFER_HEADER_SIZE);
 }
 
 void HandleDataTransfer(void)
 {
-	u32 dstArg = gBattleBufferA[gActiveBattler][1]
-			  | (gBattleBufferA[gActiveBattler][2] << 8)
-			  | (gBattleBufferA[gActiveBattler][3] << 16)
-			  | (gBattleBufferA[gActiveBattler][4] << 24);
-
-	u16 sizeArg = gBattleBufferA[gActiveBattler][5] | (gBattleBufferA[gActiveBattler][6] << 8);
+	u32 dst = gBattleBufferA[gActiveBattler][1]
+			| (gBattleBufferA[gActiveBattler][2] << 8)
+			| (gBattleBufferA[gActiveBattler][3] << 16)
+			| (gBattleBufferA[gActiveBattler][4] << 24);
 
-	u8* src = &gBattleBufferA[gActiveBattler][7];
-	u8* dst = (u8*)(dstArg);
-	u32 size = sizeArg;
+	u16 size = gBattleBufferA[gActiveBattler][5] | (gBattleBufferA[gActiveBattler][6] << 8);
 
-	while (TRUE)
-	{
-		if (size <= 0x1000)
-		{
-			Memcpy(dst, src, size);
-			break;
-		}
-		Memcpy(dst, src, 0x1000);
-		src += 0x1000;
-		dst += 0x1000;
-		size -= 0x1000;
-	}
+	Memcpy((void*) dst, &gBattleBufferA[gActiveBattler][DATA_TRANSFER_HEADER_SIZE], size);
 
 	if (SIDE(GetBattlerPosition(gActiveBattler)) == B_SIDE_OPPONENT)
 	{
@@ -266,11 +266,23 @@ static item_t FindPlayerKeystone(void)
 		if (keystone != ITEM_NONE)
 			return keystone;
 	#else
-		for (u8 i = 0; i < ARRAY_COUNT(sKeystoneTable); ++i)
+		if (!gNewBS->megaData.playerKeystoneLoaded)
 		{
-			if (CheckBagHasItem(sKeystoneTable[i], 1))
-				return sKeystoneTable[i];
+			gNewBS->megaData.playerKeystone = ITEM_NONE;
+			gNewBS->megaData.playerKeystoneLoaded = TRUE;
+
+			for (u8 i = 0; i < ARRAY_COUNT(sKeystoneTable); ++i)
+			{
+				if (CheckBagHasItem(sKeystoneTable[i], 1))
+				{
+					gNewBS->megaData.playerKeystone = sKeystoneTable[i];
+					break;
+				}
+			}
 		}
+
+		if (gNewBS->megaData.playerKeystone != ITEM_NONE)
+			return gNewBS->megaData.playerKeystone;
 	#endif
 
 	#ifdef DEBUG_MEGA
@@ -1243,7 +1243,7 @@ void atkFF26_attackstringnoprotean(void)
 			if (IsAnyMaxMove(gCurrentMove))
 				gNewBS->LastUsedMove = gChosenMove;
 
-			if (!CheckTableForMove(gCurrentMove, gMovesThatCallOtherMoves))
+			if (!IsMoveInTable(gCurrentMove, gMovesThatCallOtherMoves))
 			{
 				u8 chargingBonus = 20 * gNewBS->metronomeItemBonus[gBankAttacker];
 				if (gLastPrintedMoves[gBankAttacker] == gCurrentMove)
@@ -1271,7 +1271,7 @@ void atkFF27_tryactivateprotean(void)
 	&& !(gMoveResultFlags & MOVE_RESULT_FAILED)
 	&& gCurrentMove != MOVE_STRUGGLE
 	&& !(gHitMarker & HITMARKER_UNABLE_TO_USE_MOVE)
-	&& !(CheckTableForMove(gCurrentMove, gMovesThatCallOtherMoves)))
+	&& !(IsMoveInTable(gCurrentMove, gMovesThatCallOtherMoves)))
 	{
 		if (gBattleMons[gBankAttacker].type1 != moveType
 		||  gBattleMons[gBankAttacker].type2 != moveType
@@ -1359,7 +1359,7 @@ void atkFF29_trysetsleep(void)
 	{
 		return;
 	}
-	else if (CheckTableForMove(gCurrentMove, gPowderMoves) && TypeCalc(gCurrentMove, gBankAttacker, bank, NULL, FALSE) & MOVE_RESULT_DOESNT_AFFECT_FOE)
+	else if (IsMoveInTable(gCurrentMove, gPowderMoves) && TypeCalc(gCurrentMove, gBankAttacker, bank, NULL, FALSE) & MOVE_RESULT_DOESNT_AFFECT_FOE)
 	{
 		gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
 		gBattlescriptCurrInstr = BattleScript_PauseResultMessage;
@@ -1593,7 +1593,7 @@ void atkFF2A_trysetparalysis(void)
 	{
 		return;
 	}
-	else if ((CheckTableForMove(gCurrentMove, gPowderMoves) || gCurrentMove == MOVE_THUNDERWAVE)
+	else if ((IsMoveInTable(gCurrentMove, gPowderMoves) || gCurrentMove == MOVE_THUNDERWAVE)
 	&& TypeCalc(gCurrentMove, gBankAttacker, bank, NULL, FALSE) & MOVE_RESULT_DOESNT_AFFECT_FOE)
 	{
 		gMoveResultFlags |= MOVE_RESULT_DOESNT_AFFECT_FOE;
@@ -68,6 +68,7 @@ tables:
 extern const u16 gClassBasedTrainerEncounterBGM[NUM_TRAINER_CLASSES];
 
 //This file's functions:
+static bool8 IsTileInNPCSightLine(struct EventObject* npc, s16 x, s16 y);
 static bool8 CheckTrainerSpotting(u8 eventObjId);
 static bool8 GetTrainerFlagFromScriptPointer(const u8* data);
 static bool8 CheckNPCSpotting(u8 eventObjId);
@@ -609,18 +610,21 @@ static const struct TrainerBattleParameter sTagBattleParams[] =
 
 u8 CheckForTrainersWantingBattle(void)
 {
+	s16 playerX, playerY;
 	u8 viableMons = 0xFF;
 
 	if (FuncIsActiveTask(Task_OverworldMultiTrainers))
 		return FALSE;
 
 	ExtensionState.spotted.count = 0;
+	PlayerGetDestCoords(&playerX, &playerY);
 
 	for (u8 eventObjId = 0; eventObjId < MAP_OBJECTS_COUNT; ++eventObjId) //For each NPC on the map
 	{
 		if (!gEventObjects[eventObjId].active
 		||  gEventObjects[eventObjId].isPlayer
-		||  gEventObjects[eventObjId].trainerType == 0)
+		||  gEventObjects[eventObjId].trainerType == 0
+		||  !IsTileInNPCSightLine(&gEventObjects[eventObjId], playerX, playerY)) //Skip the script and flag lookups for NPCs that can't possibly see the player
 			continue;
 
 		if (CheckTrainerSpotting(eventObjId))
@@ -684,6 +688,22 @@ u8 CheckForTrainersWantingBattle(void)
 	return FALSE;
 }
 
+//A looser version of the checks done in GetTrainerApproachDistance - any tile that passes that
+//function also passes this one, so it can be used to rule out NPCs before doing the expensive work.
+static bool8 IsTileInNPCSightLine(struct EventObject* npc, s16 x, s16 y)
+{
+	s16 range = npc->trainerRange_berryTreeId;
+	s16 xDiff = x - npc->currentCoords.x;
+	s16 yDiff = y - npc->currentCoords.y;
+
+	if (xDiff == 0)
+		return yDiff != 0 && abs(yDiff) <= range;
+	else if (yDiff == 0)
+		return abs(xDiff) <= range;
+
+	return FALSE;
+}
+
 static bool8 CheckTrainerSpotting(u8 eventObjId) //Or just CheckTrainer
 {
 	const u8* scriptPtr = GetEventObjectScriptPointerByEventObjectId(eventObjId); //Get NPC Script Pointer from its Object Id
@@ -1524,6 +1544,81 @@ static const u8* TryUseFlashInDarkCave(void)
 }
 #endif
 
+#ifdef DEBUG_MAP_SCRIPT_PROFILING
+// Map Script Profiling
+//Keeps the most expensive map script runs seen so far so the worst map transitions can be found.
+//Cost is measured in ticks of DEBUG_TIMER_CYCLES_PER_TICK cycles.
+#define MAP_SCRIPT_PROFILE_MAGIC 0x50534D4D //"MMSP"
+#define NUM_MAP_SCRIPT_PROFILES 8
+
+struct MapScriptProfileEntry
+{
+	u8 mapGroup;
+	u8 mapNum;
+	u8 kind;
+	u8 runs; //Saturates at 0xFF
+	u16 worstTicks;
+};
+
+struct MapScriptProfile
+{
+	u32 magic;
+	struct MapScriptProfileEntry entries[NUM_MAP_SCRIPT_PROFILES]; //Unsorted
+};
+
+#define sMapScriptProfile ((struct MapScriptProfile*) 0x203F300)
+
+void EndMapScriptProfile(u16 startTime, u8 kind)
+{
+	u32 i;
+	u16 ticks = GetDebugTimerTicks() - startTime;
+	struct MapScriptProfileEntry* entry = NULL;
+	struct MapScriptProfileEntry* cheapest = &sMapScriptProfile->entries[0];
+
+	if (sMapScriptProfile->magic != MAP_SCRIPT_PROFILE_MAGIC)
+	{
+		Memset(sMapScriptProfile, 0, sizeof(struct MapScriptProfile));
+		sMapScriptProfile->magic = MAP_SCRIPT_PROFILE_MAGIC;
+	}
+
+	for (i = 0; i < NUM_MAP_SCRIPT_PROFILES; ++i)
+	{
+		struct MapScriptProfileEntry* curr = &sMapScriptProfile->entries[i];
+
+		if (curr->runs > 0
+		&& curr->kind == kind
+		&& curr->mapGroup == gSaveBlock1->location.mapGroup
+		&& curr->mapNum == gSaveBlock1->location.mapNum)
+		{
+			entry = curr;
+			break;
+		}
+
+		if (curr->worstTicks < cheapest->worstTicks)
+			cheapest = curr;
+	}
+
+	if (entry == NULL) //New map, so replace the cheapest entry if this run cost more
+	{
+		if (ticks <= cheapest->worstTicks)
+			return;
+
+		entry = cheapest;
+		entry->mapGroup = gSaveBlock1->location.mapGroup;
+		entry->mapNum = gSaveBlock1->location.mapNum;
+		entry->kind = kind;
+		entry->runs = 0;
+		entry->worstTicks = 0;
+	}
+
+	if (entry->runs < 0xFF)
+		++entry->runs;
+
+	if (ticks > entry->worstTicks)
+		entry->worstTicks = ticks;
+}
+#endif
+
 void RunOnTransitionMapScript(void)
 {
 	//Reset streaks upon moving to a new map
@@ -1531,14 +1626,24 @@ void RunOnTransitionMapScript(void)
 	gFishingStreak = 0;
 	gLastFishingSpecies = 0;
 	ResetMiningSpots();
+	ClearMetatileAttributeCache();
+	ClearWildHeaderCache();
 	ForceClockUpdate();
+
+	MAP_SCRIPT_PROFILE_START(timer);
 	MapHeaderRunScriptByTag(3);
+	MAP_SCRIPT_PROFILE_END(timer, MAP_SCRIPT_PROFILE_ON_TRANSITION);
 }
 
 void RunOnResumeMapScript(void)
 {
+	ClearMetatileAttributeCache();
+	ClearWildHeaderCache();
 	ForceClockUpdate();
+
+	MAP_SCRIPT_PROFILE_START(timer);
 	MapHeaderRunScriptByTag(5);
+	MAP_SCRIPT_PROFILE_END(timer, MAP_SCRIPT_PROFILE_ON_RESUME);
 }
 
 bool8 TryRunOnFrameMapScript(void)
@@ -1548,6 +1653,7 @@ bool8 TryRunOnFrameMapScript(void)
 	if (gQuestLogMode != 3)
 	{
 		const u8* ptr;
+		MAP_SCRIPT_PROFILE_START(timer);
 
 		#ifdef ONLY_CHECK_ITEM_FOR_HM_USAGE
 		ptr = TryUseFlashInDarkCave();
@@ -1556,6 +1662,8 @@ bool8 TryRunOnFrameMapScript(void)
 		#endif
 			ptr = MapHeaderCheckScriptTable(MAP_SCRIPT_ON_FRAME_TABLE);
 
+		MAP_SCRIPT_PROFILE_END(timer, MAP_SCRIPT_PROFILE_ON_FRAME_CHECK);
+
 		if (ptr != NULL)
 		{
 			ScriptContext1_SetupScript(ptr);
@@ -1566,6 +1674,93 @@ bool8 TryRunOnFrameMapScript(void)
 	return FALSE;
 }
 
+// Metatile Attribute Cache
+//Attributes only depend on the metatile id and the loaded tilesets, so they're cached per metatile
+//instead of per map cell. Edits through setmetatile only change the id stored in the map grid,
+//so they're picked up automatically without having to rebuild anything.
+#define NUM_METATILES_IN_PRIMARY 0x280
+#define NUM_METATILES_TOTAL 0x400
+
+#define PACKED_ATTR_BEHAVIOR_MASK 0x1FF
+#define PACKED_ATTR_ENCOUNTER_TYPE_SHIFT 9
+#define PACKED_ATTR_ENCOUNTER_TYPE_MASK 0x7
+#define PACKED_ATTR_LAYER_TYPE_SHIFT 12
+#define PACKED_ATTR_LAYER_TYPE_MASK 0x3
+#define PACKED_ATTR_UNLOADED 0xFFFF
+
+struct MetatileAttributeCache
+{
+	const struct Tileset* primaryTileset;
+	const struct Tileset* secondaryTileset;
+	u16 attributes[NUM_METATILES_TOTAL];
+};
+
+#define sMetatileAttributeCache ((struct MetatileAttributeCache*) 0x203E300)
+
+void ClearMetatileAttributeCache(void)
+{
+	sMetatileAttributeCache->primaryTileset = NULL;
+	sMetatileAttributeCache->secondaryTileset = NULL;
+}
+
+static u16 GetPackedMetatileAttributes(u32 metatileId)
+{
+	u32 rawAttributes;
+	u16 packed;
+	const struct MapLayout* mapLayout = gMapHeader.mapLayout;
+	struct MetatileAttributeCache* cache = sMetatileAttributeCache;
+
+	if (cache->primaryTileset != mapLayout->primaryTileset
+	||  cache->secondaryTileset != mapLayout->secondaryTileset) //Tilesets changed since the cache was filled
+	{
+		Memset(cache->attributes, 0xFF, sizeof(cache->attributes));
+		cache->primaryTileset = mapLayout->primaryTileset;
+		cache->secondaryTileset = mapLayout->secondaryTileset;
+	}
+
+	packed = cache->attributes[metatileId];
+	if (packed != PACKED_ATTR_UNLOADED)
+		return packed;
+
+	if (metatileId < NUM_METATILES_IN_PRIMARY)
+		rawAttributes = ((u32*) mapLayout->primaryTileset->metatileAttributes)[metatileId];
+	else
+		rawAttributes = ((u32*) mapLayout->secondaryTileset->metatileAttributes)[metatileId - NUM_METATILES_IN_PRIMARY];
+
+	packed = (GetMetatileAttributeFromRawMetatileBehavior(rawAttributes, METATILE_ATTRIBUTE_BEHAVIOR) & PACKED_ATTR_BEHAVIOR_MASK)
+		   | (GetMetatileAttributeFromRawMetatileBehavior(rawAttributes, METATILE_ATTRIBUTE_ENCOUNTER_TYPE) & PACKED_ATTR_ENCOUNTER_TYPE_MASK) << PACKED_ATTR_ENCOUNTER_TYPE_SHIFT
+		   | (GetMetatileAttributeFromRawMetatileBehavior(rawAttributes, METATILE_ATTRIBUTE_LAYER_TYPE) & PACKED_ATTR_LAYER_TYPE_MASK) << PACKED_ATTR_LAYER_TYPE_SHIFT;
+
+	cache->attributes[metatileId] = packed;
+	return packed;
+}
+
+//Drop-in replacement for MapGridGetMetatileField for the attributes stored in the cache
+u32 GetCachedMetatileAttributeAt(s16 x, s16 y, u8 attributeType)
+{
+	u32 metatileId = MapGridGetMetatileIdAt(x, y);
+
+	if (metatileId >= NUM_METATILES_TOTAL)
+		return 0xFF; //Same as the vanilla lookup
+
+	switch (attributeType)
+	{
+		case METATILE_ATTRIBUTE_BEHAVIOR:
+			return GetPackedMetatileAttributes(metatileId) & PACKED_ATTR_BEHAVIOR_MASK;
+		case METATILE_ATTRIBUTE_ENCOUNTER_TYPE:
+			return (GetPackedMetatileAttributes(metatileId) >> PACKED_ATTR_ENCOUNTER_TYPE_SHIFT) & PACKED_ATTR_ENCOUNTER_TYPE_MASK;
+		case METATILE_ATTRIBUTE_LAYER_TYPE:
+			return (GetPackedMetatileAttributes(metatileId) >> PACKED_ATTR_LAYER_TYPE_SHIFT) & PACKED_ATTR_LAYER_TYPE_MASK;
+		default:
+			return MapGridGetMetatileField(x, y, attributeType);
+	}
+}
+
+u32 GetCachedMetatileBehaviorAt(s16 x, s16 y)
+{
+	return GetCachedMetatileAttributeAt(x, y, METATILE_ATTRIBUTE_BEHAVIOR);
+}
+
 // Whiteout Hack
 void __attribute__((long_call)) Task_RushInjuredPokemonToCenter(u8 taskId);
 void FieldCB_RushInjuredPokemonToCenter(void)
@@ -1680,9 +1875,9 @@ static bool8 PlayerIsMovingOnSidewaysStairs(u8 direction)
 	switch (direction)
 	{
 		case DIR_WEST:
-			return MetatileBehavior_IsWestSidewaysStairs(MapGridGetMetatileBehaviorAt(x, y));
+			return MetatileBehavior_IsWestSidewaysStairs(GetCachedMetatileBehaviorAt(x, y));
 		case DIR_EAST:
-			return MetatileBehavior_IsEastSidewaysStairs(MapGridGetMetatileBehaviorAt(x, y));
+			return MetatileBehavior_IsEastSidewaysStairs(GetCachedMetatileBehaviorAt(x, y));
 	}
 
 	return FALSE;
@@ -1988,7 +2183,7 @@ u8 GetLedgeJumpDirection(s16 x, s16 y, u8 direction)
 		direction -= 4;
 
 	direction--;
-	behaviour = MapGridGetMetatileBehaviorAt(x, y);
+	behaviour = GetCachedMetatileBehaviorAt(x, y);
 
 	if (GetLedgeJumpFuncs[direction](behaviour) == 1)
 		return direction + 1;
@@ -2281,7 +2476,7 @@ void ShouldLadderClimbContinue(void)
 	s16 y = playerEventObj->currentCoords.y;
 
 	MoveCoords(gSpecialVar_PlayerFacing, &x, &y);
-	gSpecialVar_LastResult = MetatileBehavior_IsClimbableLadder(MapGridGetMetatileBehaviorAt(x, y));
+	gSpecialVar_LastResult = MetatileBehavior_IsClimbableLadder(GetCachedMetatileBehaviorAt(x, y));
 }
 
 void IsUnboundToVar(void)
@@ -2305,7 +2500,7 @@ bool8 IsPlayerFacingRockClimbableWall(void)
 	s16 y = playerEventObj->currentCoords.y;
 
 	MoveCoords(playerEventObj->facingDirection, &x, &y);
-	return MetatileBehavior_IsRockClimbableWall(MapGridGetMetatileBehaviorAt(x, y));
+	return MetatileBehavior_IsRockClimbableWall(GetCachedMetatileBehaviorAt(x, y));
 }
 
 void ShouldRockClimbContinue(void)
@@ -2322,9 +2517,9 @@ void ShouldRockClimbContinueDiagonally(void)
 
 	MoveCoords(playerEventObj->facingDirection, &x, &y);
 
-	if (MetatileBehavior_IsRockClimbableWall(MapGridGetMetatileBehaviorAt(x, y + 1)))
+	if (MetatileBehavior_IsRockClimbableWall(GetCachedMetatileBehaviorAt(x, y + 1)))
 		gSpecialVar_LastResult = 2; //Move diagonal up
-	else if (y != 0 && MetatileBehavior_IsRockClimbableWall(MapGridGetMetatileBehaviorAt(x, y - 1)))
+	else if (y != 0 && MetatileBehavior_IsRockClimbableWall(GetCachedMetatileBehaviorAt(x, y - 1)))
 		gSpecialVar_LastResult = 1; //Move diagonal down
 	else
 	#endif
@@ -2405,7 +2600,7 @@ static bool8 IsPlayerFacingSurfableLava(void)
 	MoveCoords(playerEventObj->facingDirection, &x, &y);
 	return GetCollisionAtCoords(playerEventObj, x, y, playerEventObj->facingDirection) == 3
 		&& PlayerGetZCoord() == 3
-		&& MetatileBehavior_IsLava(MapGridGetMetatileBehaviorAt(x, y));
+		&& MetatileBehavior_IsLava(GetCachedMetatileBehaviorAt(x, y));
 }
 #endif
 
@@ -2694,7 +2889,7 @@ void TryLoadMiningSpots(void)
 			//Choose random spot
 			s16 x = Random() % width + 7;
 			s16 y = Random() % height + 7;
-			u8 metatileBehavior = MapGridGetMetatileBehaviorAt(x, y);
+			u8 metatileBehavior = GetCachedMetatileBehaviorAt(x, y);
 			
 			//Make sure correct type of spot
 			if (metatileBehavior == MB_UNDERGROUND_MINING)
@@ -20,6 +20,7 @@
 #include "../include/new/build_pokemon.h"
 #include "../include/new/frontier.h"
 #include "../include/new/mega.h"
+#include "../include/new/sprite_filter.h"
 
 extern const u8 RaidBattleIntroBGTiles[];
 extern const u8 RaidBattleIntroBGPal[];
@@ -292,103 +293,9 @@ static bool8 GetRaidBattleData(void)
 
 static void OutlineMonSprite(u8 spriteId)
 {
-	u32 i = 0;
-	u8 buffer[(64 * 64) / 2] = {0};
-	u8* offset = (void*)(OBJ_VRAM0) + (gSprites[spriteId].oam.tileNum * 32);
-	u8* originalOffset = offset;
+	u32* tiles = (u32*) ((OBJ_VRAM0) + (gSprites[spriteId].oam.tileNum * 32));
 
-	for (i = 0; i < (64 * 64) / 2; ++i)
-	{
-		/*Pixel Map - Bits
-		6	7
-
-		1	2	3
-
-		4	5
-		*/
-
-		/*Pixel map - Bytes
-		67
-		12 3
-		45
-		*/
-
-		u8 nextByteColumn = 1;
-		if (i % 4 == 3)
-			nextByteColumn = 0x1D;
-
-		u8 nextByteRow = 4;
-		if (i % 0x20 >= 0x1C)
-			nextByteRow = 0xE4;
-
-		u8 previousByteRow = 4;
-		if (i % 0x20 < 4)
-			previousByteRow = 0xE4;
-
-		//Next column
-		u8 pixel1 = offset[i] & 0xF;
-		u8 pixel2 = (offset[i] >> 4) & 0xF;
-
-		u8 pixel3 = offset[i + nextByteColumn] & 0xF;
-
-		//Next row
-		u8 pixel4 = offset[i + nextByteRow] & 0xF;
-		u8 pixel5 = (offset[i + nextByteRow] >> 4) & 0xF;
-
-		//Row Above
-		u8 pixel6 = offset[i - previousByteRow] & 0xF;
-		u8 pixel7 = (offset[i - previousByteRow] >> 4) & 0xF;
-
-		bool8 isTopBorder = (i < 0xE4) && ((i % 0x20) < 4);
-		bool8 isBottomBorder = (i >= 0x71C) && ((i % 0x20) >= 0x1C);
-		bool8 isLeftBorder = ((i % 0x100) < 0x20) && ((i % 4) == 0);
-		bool8 isRightBorder = ((i % 0x100) >= 0xE0) && ((i % 4) == 3);
-
-		if (pixel1 != 0)
-		{
-			if (isTopBorder || isBottomBorder || isLeftBorder)
-				buffer[i + 0] |= 0xF; //Set lower bit to white
-			else
-				buffer[i + 0] |= 0x1; //Set lower bit to black
-
-			if (pixel2 == 0)
-				buffer[i + 0] |= 0xF0; //Set upper bit
-
-			if (pixel4 == 0)
-				buffer[i + nextByteRow] |= 0xF; //Set lower bit
-
-			if (i >= previousByteRow && pixel6 == 0)
-				buffer[i - previousByteRow] |= 0xF; //Set lower bit*/
-		}
-
-		if (pixel2 != 0)
-		{
-			if (isTopBorder || isBottomBorder || isRightBorder) //Right border
-				buffer[i + 0] |= 0xF0; //Set upper bit to white
-			else
-				buffer[i + 0] |= 0x10; //Set upper bit to black
-
-			if (pixel1 == 0)
-				buffer[i + 0] |= 0xF; //Set lower bit
-
-			if (pixel3 == 0 && (i % 0x100 < 0xE0 || i % 4 != 3))
-				buffer[i + nextByteColumn] |= 0xF; //Set lower bit
-
-			if (pixel5 == 0)
-				buffer[i + nextByteRow] |= 0xF0; //Set upper bit
-
-			if (i >= previousByteRow && pixel7 == 0)
-				buffer[i - previousByteRow] |= 0xF0; //Set upper bit
-		}
-
-		if (pixel3 != 0 && !isRightBorder)
-		{
-			if (pixel2 == 0)
-				buffer[i + 0] |= 0xF0; //Set upper bit
-		}
-	}
-
-	CpuCopy32(buffer, originalOffset, (64 * 64) / 2);
+	OutlineSpriteTiles(tiles, 64 / 8, 64 / 8, 0x1, 0xF); //Black body with a white outline
 	++sRaidBattleIntroPtr->outlinedSprite;
 }
 
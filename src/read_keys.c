@@ -11,6 +11,7 @@
 #include "../include/party_menu.h"
 #include "../include/constants/region_map_sections.h"
 
+#include "../include/new/battle_replay.h"
 #include "../include/new/dexnav.h"
 #include "../include/new/overworld.h"
 #include "../include/new/read_keys.h"
@@ -117,6 +118,10 @@ void ReadKeys(void)
 	#else
 		u16 keyInput = REG_KEYINPUT ^ KEYS_MASK;
 	#endif
+
+	#ifdef DEBUG_BATTLE_REPLAY
+		keyInput = TryRecordOrReplayBattleKeys(keyInput);
+	#endif
 	gMain.newKeysRaw = keyInput & ~gMain.heldKeysRaw;
 	gMain.newKeys = gMain.newKeysRaw;
 	gMain.newAndRepeatedKeys = gMain.newKeysRaw;
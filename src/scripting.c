@@ -1837,7 +1837,9 @@ void sp0B1_ChooseItemFromBag(void)
 void sp0B2_PokemonTypeInParty(void)
 {
 	u8 type = Var8000;
+	MAP_SCRIPT_PROFILE_START(timer);
 
+	gSpecialVar_LastResult = PARTY_SIZE;
 	for (int i = 0; i < PARTY_SIZE; ++i)
 	{
 		u16 species = GetMonData(&gPlayerParty[i], MON_DATA_SPECIES, NULL);
@@ -1849,12 +1851,12 @@ void sp0B2_PokemonTypeInParty(void)
 			||  type == gBaseStats[species].type2)
 			{
 				gSpecialVar_LastResult = i;
-				return;
+				break;
 			}
 		}
 	}
 
-	gSpecialVar_LastResult = PARTY_SIZE;
+	MAP_SCRIPT_PROFILE_END(timer, MAP_SCRIPT_PROFILE_SPECIAL_TYPE_IN_PARTY);
 }
 
 //@Details: Checks if any Pokemon in the player's party can learn Draco Meteor.
@@ -1968,14 +1970,10 @@ bool8 sp18B_ShowFossilImage(void) {
 	return TRUE;
 }
 
-//@Details: Checks if any Pokemon in the player's party can learn the given
-//			TM or HM.
-//@Input:	Var 0x8000: TM/HM id (1 - 128).
-//@Returns: Given Var: Party id of mon that can learn it. PARTY_SIZE if none can.
-u8 sp0D0_PokemonInPartyThatCanLearnTMHM(void)
+static u8 FindPokemonInPartyThatCanLearnTMHM(u16 tm)
 {
 	u32 i;
-	u16 tm = Var8000;
+
 	for (i = 0; i < ITEMS_COUNT; ++i)
 	{
 		if (TMIdFromItemId(i) == tm)
@@ -1994,6 +1992,19 @@ u8 sp0D0_PokemonInPartyThatCanLearnTMHM(void)
 	return PARTY_SIZE;
 }
 
+//@Details: Checks if any Pokemon in the player's party can learn the given
+//			TM or HM.
+//@Input:	Var 0x8000: TM/HM id (1 - 128).
+//@Returns: Given Var: Party id of mon that can learn it. PARTY_SIZE if none can.
+u8 sp0D0_PokemonInPartyThatCanLearnTMHM(void)
+{
+	MAP_SCRIPT_PROFILE_START(timer);
+	u8 partyId = FindPokemonInPartyThatCanLearnTMHM(Var8000);
+	MAP_SCRIPT_PROFILE_END(timer, MAP_SCRIPT_PROFILE_SPECIAL_TMHM_IN_PARTY);
+
+	return partyId;
+}
+
 // Hall of Fame Fix for Expanded Pokemon
 // credit to sagiri: https://github.com/Sagiri/fame-hall
 
@@ -0,0 +1,131 @@
+#include "defines.h"
+
+#include "../include/new/sprite_filter.h"
+/*
+sprite_filter.c
+	filters for outlining, silhouetting, and recolouring 4bpp sprites
+*/
+
+/*
+Each row of a 4bpp tile is one word holding 8 pixels, with the leftmost pixel
+in the lowest nibble. The filters first reduce every row to a mask holding bit 0
+of each nibble for the opaque pixels. After that, each neighbour test covers a
+whole row with a shift and an OR, rather than one nibble at a time.
+*/
+
+#define NIBBLE_LSBS		0x11111111
+#define LEFT_PIXEL		0x00000001
+#define RIGHT_PIXEL		0x10000000
+#define TILE_ROWS		8
+
+//This file's functions:
+static u32 GetOpaqueMask(u32 row);
+
+static u32 GetOpaqueMask(u32 row)
+{
+	row |= row >> 2;
+	row |= row >> 1;
+	return row & NIBBLE_LSBS;
+}
+
+//Colours the opaque pixels in bodyColour, and the transparent pixels touching them
+//in outlineColour. Opaque pixels on the edge of the frame get outlineColour too.
+//The tiles are expected in 1D mapping order, and are filtered in place.
+void OutlineSpriteTiles(u32* tiles, u8 widthTiles, u8 heightTiles, u8 bodyColour, u8 outlineColour)
+{
+	u32 x, y, row, i;
+	u32 tileRowWords = widthTiles * TILE_ROWS; //Distance between a row and the same row one tile down
+	u32 numWords = tileRowWords * heightTiles;
+	u32* masks = Malloc(numWords * sizeof(u32));
+
+	if (masks == NULL)
+		return;
+
+	for (i = 0; i < numWords; ++i)
+		masks[i] = GetOpaqueMask(tiles[i]);
+
+	for (y = 0, i = 0; y < heightTiles; ++y)
+	{
+		for (x = 0; x < widthTiles; ++x)
+		{
+			for (row = 0; row < TILE_ROWS; ++row, ++i)
+			{
+				u32 opaque = masks[i];
+				u32 edge = 0;
+				u32 neighbours;
+
+				//Pixels to the left and right, carrying in from the tiles on either side
+				neighbours = (opaque << 4) | (opaque >> 4);
+				if (x > 0)
+					neighbours |= masks[i - TILE_ROWS] >> 28;
+				else
+					edge |= LEFT_PIXEL;
+
+				if (x < widthTiles - 1u)
+					neighbours |= masks[i + TILE_ROWS] << 28;
+				else
+					edge |= RIGHT_PIXEL;
+
+				//Pixels above and below, crossing into the tiles above and below
+				if (row > 0)
+					neighbours |= masks[i - 1];
+				else if (y > 0)
+					neighbours |= masks[i - tileRowWords + (TILE_ROWS - 1)];
+				else
+					edge = NIBBLE_LSBS;
+
+				if (row < TILE_ROWS - 1)
+					neighbours |= masks[i + 1];
+				else if (y < heightTiles - 1u)
+					neighbours |= masks[i + tileRowWords - (TILE_ROWS - 1)];
+				else
+					edge = NIBBLE_LSBS;
+
+				//Each mask holds at most 1 per nibble, so multiplying fills the nibbles without carrying
+				tiles[i] = ((neighbours & ~opaque) | (opaque & edge)) * outlineColour
+						 | (opaque & ~edge) * bodyColour;
+			}
+		}
+	}
+
+	Free(masks);
+}
+
+//Colours every opaque pixel in the given colour.
+void SilhouetteSpriteTiles(u32* tiles, u8 widthTiles, u8 heightTiles, u8 colour)
+{
+	u32 numWords = widthTiles * heightTiles * TILE_ROWS;
+
+	for (u32 i = 0; i < numWords; ++i)
+		tiles[i] = GetOpaqueMask(tiles[i]) * colour;
+}
+
+u16 GrayscaleColour(u16 colour)
+{
+	s32 r = colour & 31;
+	s32 g = (colour >> 5) & 31;
+	s32 b = (colour >> 10) & 31;
+	s32 gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+	return RGB2(gray, gray, gray);
+}
+
+//Blends coeff / 32 of tint into colour.
+u16 TintColour(u16 colour, u16 tint, u8 coeff)
+{
+	const u32 rbmask = ((0x1F) | (0x1F << 10)), gmask = 0x1F << 5;
+	const u32 rbhalf = 0x4010, ghalf = 0x0200;
+
+	//Red and blue are blended together, with green kept out of the way between them
+	u32 parta = colour & rbmask;
+	u32 partb = tint & rbmask;
+	u32 part = (partb - parta) * coeff + parta * 32 + rbhalf;
+	u16 clr = (part >> 5) & rbmask;
+
+	//Green
+	parta = colour & gmask;
+	partb = tint & gmask;
+	part = (partb - parta) * coeff + parta * 32 + ghalf;
+	clr |= (part >> 5) & gmask;
+
+	return clr;
+}
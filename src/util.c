@@ -424,3 +424,16 @@ bool8 CanPartyMonBeFrozen(struct Pokemon* mon)
 
 	return TRUE;
 }
+
+//Starts Timer 2 if it isn't already running and returns its count.
+//Shared by the debug profilers, which time themselves with the difference of two reads.
+u16 GetDebugTimerTicks(void)
+{
+	if (!(REG_TM2CNT_H & TIMER_ENABLE))
+	{
+		REG_TM2CNT_L = 0;
+		REG_TM2CNT_H = TIMER_ENABLE | TIMER_1024CLK;
+	}
+
+	return REG_TM2CNT_L;
+}
@@ -52,10 +52,34 @@ extern const u16 gSwarmTableLength;
 
 extern bool8 CheckAndSetDailyEvent(u16 eventVar, bool8 setDailyEventVar);
 
+//Wild header lookups are done multiple times every step, so the index of the current
+//map's header in each table is remembered until the player changes maps.
+enum
+{
+	WILD_HEADER_TABLE_DAY,
+	WILD_HEADER_TABLE_MORNING,
+	WILD_HEADER_TABLE_EVENING,
+	WILD_HEADER_TABLE_NIGHT,
+	NUM_WILD_HEADER_TABLES,
+};
+
+#define WILD_HEADER_UNSEARCHED 0xFFFF
+#define WILD_HEADER_NOT_FOUND 0xFFFE
+
+struct WildHeaderCache
+{
+	u8 mapGroup;
+	u8 mapNum;
+	u16 headerIds[NUM_WILD_HEADER_TABLES];
+};
+
+#define sWildHeaderCache ((struct WildHeaderCache*) 0x203E080)
+
 //This file's functions
 static u8 ChooseWildMonLevel(const struct WildPokemon* wildPokemon);
 static const struct WildPokemonHeader* GetCurrentMapWildMonHeader(void);
 static const struct WildPokemonHeader* GetCurrentMapWildMonDaytimeHeader(void);
+static u16 GetWildHeaderIdForCurrentMap(const struct WildPokemonHeader* headerTable, u8 tableId);
 static u8 PickWildMonNature(void);
 static bool8 TryGenerateWildMon(const struct WildPokemonInfo* wildMonInfo, u8 area, u8 flags);
 static species_t GenerateFishingWildMon(const struct WildPokemonInfo* wildMonInfo, u8 rod);
@@ -153,24 +177,30 @@ static const struct WildPokemonHeader* GetCurrentMapWildMonHeader(void)
 
 	#ifdef TIME_ENABLED
 		u32 i;
-
+		u8 tableId = WILD_HEADER_TABLE_DAY;
 		const struct WildPokemonHeader* headerTable = NULL;
 
 		if (IsNightTime())
+		{
 			headerTable = gWildMonNightHeaders;
+			tableId = WILD_HEADER_TABLE_NIGHT;
+		}
 		else if (IsMorning())
+		{
 			headerTable = gWildMonMorningHeaders;
+			tableId = WILD_HEADER_TABLE_MORNING;
+		}
 		else if (IsEvening())
+		{
 			headerTable = gWildMonEveningHeaders;
+			tableId = WILD_HEADER_TABLE_EVENING;
+		}
 
 		if (headerTable != NULL) //Not Daytime
 		{
-			for (i = 0; headerTable[i].mapGroup != 0xFF; ++i)
-			{
-				if (headerTable[i].mapGroup == gSaveBlock1->location.mapGroup
-				&&  headerTable[i].mapNum == gSaveBlock1->location.mapNum)
-					return &headerTable[i];
-			}
+			i = GetWildHeaderIdForCurrentMap(headerTable, tableId);
+			if (i != WILD_HEADER_NOT_FOUND)
+				return &headerTable[i];
 		}
 	#endif
 
@@ -189,35 +219,68 @@ static const struct WildPokemonHeader* GetCurrentMapWildMonDaytimeHeader(void)
 			gWildDataSwitch = NULL;
 	}
 
-	for (i = 0; gWildMonHeaders[i].mapGroup != 0xFF; ++i)
+	i = GetWildHeaderIdForCurrentMap(gWildMonHeaders, WILD_HEADER_TABLE_DAY);
+	if (i != WILD_HEADER_NOT_FOUND)
 	{
-		const struct WildPokemonHeader* wildHeader = &gWildMonHeaders[i];
+		#ifdef ALTERING_CAVE_ENABLED
+		if (gSaveBlock1->location.mapGroup == MAP_GROUP(ALTERING_CAVE)
+		&&  gSaveBlock1->location.mapNum == MAP_NUM(ALTERING_CAVE))
+		{
+			u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+			if (alteringCaveId > 8)
+				alteringCaveId = 0;
 
-		if (wildHeader->mapGroup == gSaveBlock1->location.mapGroup
-		&&  wildHeader->mapNum   == gSaveBlock1->location.mapNum)
+			i += alteringCaveId;
+		}
+		#endif
+
+		#ifdef TANOBY_RUINS_ENABLED
+		if (!CanEncounterUnownInTanobyRuins()) //A function that returns true if the
+			return NULL;					 //Tanoby Key flag has been set.
+		#endif								 //If it hasn't, and you're in the ruins, then
+											 //return false to indicate no Pokemon can be found.
+		return &gWildMonHeaders[i];
+	}
+
+	return NULL;
+}
+
+static u16 GetWildHeaderIdForCurrentMap(const struct WildPokemonHeader* headerTable, u8 tableId)
+{
+	u32 i;
+	u8 mapGroup = gSaveBlock1->location.mapGroup;
+	u8 mapNum = gSaveBlock1->location.mapNum;
+
+	if (sWildHeaderCache->mapGroup != mapGroup || sWildHeaderCache->mapNum != mapNum)
+	{
+		sWildHeaderCache->mapGroup = mapGroup;
+		sWildHeaderCache->mapNum = mapNum;
+		for (i = 0; i < NUM_WILD_HEADER_TABLES; ++i)
+			sWildHeaderCache->headerIds[i] = WILD_HEADER_UNSEARCHED;
+	}
+
+	if (sWildHeaderCache->headerIds[tableId] == WILD_HEADER_UNSEARCHED)
+	{
+		sWildHeaderCache->headerIds[tableId] = WILD_HEADER_NOT_FOUND;
+
+		for (i = 0; headerTable[i].mapGroup != 0xFF; ++i)
 		{
-			#ifdef ALTERING_CAVE_ENABLED
-			if (gSaveBlock1->location.mapGroup == MAP_GROUP(ALTERING_CAVE)
-			&&  gSaveBlock1->location.mapNum == MAP_NUM(ALTERING_CAVE))
+			if (headerTable[i].mapGroup == mapGroup
+			&&  headerTable[i].mapNum == mapNum)
 			{
-				u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-				if (alteringCaveId > 8)
-					alteringCaveId = 0;
-
-				i += alteringCaveId;
+				sWildHeaderCache->headerIds[tableId] = i;
+				break;
 			}
-			#endif
-
-			#ifdef TANOBY_RUINS_ENABLED
-			if (!CanEncounterUnownInTanobyRuins()) //A function that returns true if the
-				return NULL;					 //Tanoby Key flag has been set.
-			#endif								 //If it hasn't, and you're in the ruins, then
-												 //return false to indicate no Pokemon can be found.
-			return &gWildMonHeaders[i];
 		}
 	}
 
-	return NULL;
+	return sWildHeaderCache->headerIds[tableId];
+}
+
+void ClearWildHeaderCache(void)
+{
+	sWildHeaderCache->mapGroup = 0xFF;
+	sWildHeaderCache->mapNum = 0xFF;
 }
 
 